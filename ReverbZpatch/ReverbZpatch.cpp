@@ -2,22 +2,33 @@
 #include "daisysp.h"
 //#include "../../libDaisy/src/dev/sdram.h"
 #include "dspConfig.hpp"
+#include "controlTapers.hpp"
 #include "../_projLib/ReverbZ.hpp"
+#include "../_projLib/HalfRateReverbZ.hpp"
+#include "../_projLib/LoadMonitor.hpp"
 #include "../_helperUtils/ctrlUtils.hpp"
-#include "../../dspLib/Utils/sdramArena.h"
 #include <cstdio>
 
-// Reserve SDRAM space for arena allocator
-// This forces the linker to allocate space in .sdram_bss section
-#define SDRAM_BUFFER_SIZE (16 * 1024 * 1024)  // 16MB reserve
-volatile uint8_t DSY_SDRAM_BSS sdramPool[SDRAM_BUFFER_SIZE]; // volatile prevents optimization; __attribute__((used)) prevents GC
-
 using namespace daisy;
 using namespace patch_sm;
 //using namespace daisysp;
 using namespace projLib;
 
-using ReverbZ_t = projLib::ReverbZ<DSPLIB_MAX_BUFFER_SIZE>;
+// Per-line power-of-two delay buffers (mask wrapping), spread over DTCM / AXI SRAM / SDRAM
+// by the arena planner. (DelayStorage::PerLine: tightest buffers, compare-and-wrap.
+// DelayStorage::Shared: one power-of-two buffer for the whole network)
+// Tank lines in float. (Float16Format halves their memory, ~70 dB SNR against float:
+// build with -mfp16-format=ieee for the hardware conversion)
+// Linear interpolation on the modulated allpasses. (HermiteInterpolation / AllpassInterpolation:
+// brighter modulated tail, cost of those two lines measured by tools/interpolationBenchmark)
+// HALF_RATE=1 builds: the same network at FS_REVERBZ/2 between halfband resamplers.
+#ifdef REVERBZ_HALF_RATE
+using ReverbZ_t = projLib::HalfRateReverbZ<REVERBZ_MAX_PREDELAY_SAMPLES, FS_REVERBZ, DelayStorage::PerLineMasked, Float32Format,
+                                           LinearInterpolation>;
+#else
+using ReverbZ_t = projLib::ReverbZ<REVERBZ_MAX_PREDELAY_SAMPLES, FS_REVERBZ, DelayStorage::PerLineMasked, Float32Format,
+                                   LinearInterpolation>;
+#endif
 
 /** Our hardware board class handles the interface to the actual DaisyPatchSM
  * hardware. */
@@ -26,11 +37,16 @@ DaisyPatchSM patch;
 Switch button;
 Switch toggle;
 
-/* Environment Constants */
-const int FS_REVERBZ = 48000;  // ReverbZ fixed sample rate
-
 /** ReverbZ reverb processor instance */
-ReverbZ_t reverbz(FS_REVERBZ); // Object allocated on stack, buffers in SDRAM via init().
+ReverbZ_t reverbz;             // Object allocated on stack, buffers placed via init().
+/* ReverbZ delay lines storage: one block per memory tier, lines placed by the arena planner */
+float DSY_DTCMRAM_BSS reverbzDtcmMemory[REVERBZ_DTCM_BUDGET];
+float reverbzAxiSramMemory[REVERBZ_AXI_SRAM_BUDGET];                    // default .bss: AXI SRAM
+float DSY_SDRAM_BSS reverbzSdramMemory[ReverbZ_t::kArenaMemorySize];    // room for every line
+TieredArena reverbzArena;
+
+/** Audio callback load: duration against the block period, overruns (CPU cycles, DWT) */
+LoadMonitor<> loadMonitor;
 
 /* Control Parameters for ReverbZ */
 double predelayTimeCtrl = 00.0;          // in ms
@@ -88,13 +104,12 @@ void AudioCallback(AudioHandle::InputBuffer  in,
                    AudioHandle::OutputBuffer out,
                    size_t                    size)
 {
-    for(size_t i = 0; i < size; i++)
-    {
-        /* Process Audio */
-        reverbz.processAudioStereo(in[0][i], in[1][i]);  // Process stereo input
-        out[0][i] = reverbz.mOutL;          // Left output
-        out[1][i] = reverbz.mOutR;          // Right output
-    }
+    const CycleCounter::Count callbackStart = loadMonitor.beginCallback();
+
+    /* Process Audio: whole stereo block, written straight into the output buffers */
+    reverbz.processBlock(in[0], in[1], out[0], out[1], size);
+
+    loadMonitor.endCallback(callbackStart);
 }
 
 int main(void)
@@ -128,6 +143,18 @@ int main(void)
     int paramsPage = 0;
     int nParamsPages = 3;
 
+    /* Audio callback load */
+    LoadTelemetry loadTelemetry = {};
+
+#ifdef DEBUG
+    /* USB serial reports */
+    const int reportLoops = 1000;           // main loop iterations between reports (~1 s)
+    int reportCounter = 0;
+#ifdef PROJLIB_STAGE_PROFILING
+    ReverbZ_t::Profile reverbzProfile;
+#endif
+#endif
+
     /* -------------------------- ReverbZ Controls -------------------------- */
     float predelayTimeCtrlNorm = 0.0f;      // normalized [0.0 - 1.0]
     float predelayTimeCtrl = 0.0f;          // in ms
@@ -167,25 +194,41 @@ int main(void)
     toggle.Init(patch.B8);          // Setup toggle switch on pin B8
     // Don't need to initialize pots. 
 
-    // Touch sdramPool to prevent linker garbage collection
-    sdramPool[0] = 0;
-
-    // Wait a bit for everything to settle
-    System::Delay(100);
-
-    /** Initialize SDRAM arena allocator (must be after patch.Init()) */
-    sdramArenaInit();
-
-    // Wait a bit for everything to settle
-    System::Delay(100);
+    /** Init ReverbZ buffers in DTCM / AXI SRAM / SDRAM */
+    reverbzArena.setTier(MemoryTier::DTCM, reverbzDtcmMemory, REVERBZ_DTCM_BUDGET);
+    reverbzArena.setTier(MemoryTier::AxiSram, reverbzAxiSramMemory, REVERBZ_AXI_SRAM_BUDGET);
+    reverbzArena.setTier(MemoryTier::Sdram, reverbzSdramMemory, ReverbZ_t::kArenaMemorySize);
+    if (!reverbz.init(reverbzArena))
+    {
+        // The SDRAM tier is sized to hold every line: should not happen, but never
+        // leave a line unbound. Fall back to all the lines packed in SDRAM.
+        reverbzArena.reset();
+        reverbz.init(reverbzSdramMemory);
+    }
 
-    /** Init ReverbZ buffers in SDRAM (must be after sdramArenaInit()) */
-    reverbz.init(); // Allocate buffers on SDRAM
+#ifdef DEBUG
+    /** Report ReverbZ delay storage (per instance) and where each line landed */
+    patch.StartLog();
+    patch.PrintLine("ReverbZ delay memory: %u bytes per instance (%u bytes external)",
+                    static_cast<unsigned>(ReverbZ_t::kMemoryBytes),
+                    static_cast<unsigned>(ReverbZ_t::kDelayMemorySize*sizeof(float)));
+    const char* tierNames[kNumMemoryTiers] = {"DTCM", "AXI SRAM", "SDRAM"};
+    for (std::size_t i = 0; i < reverbzArena.getPlacementCount(); i++)
+    {
+        const TieredArena::Placement& placement = reverbzArena.getPlacement(i);
+        patch.PrintLine("  %s: %u floats in %s", placement.name,
+                        static_cast<unsigned>(placement.size),
+                        tierNames[static_cast<std::size_t>(placement.tier)]);
+    }
+#endif
 
     /* Set Audio parameters */
     patch.SetAudioSampleRate(FS_REVERBZ); // Set sample rate to 48kHz
     patch.SetAudioBlockSize(4);           // Set block size to 4 samples
 
+    /* Callback budget: one block period in CPU cycles (40000 at 480 MHz, 4 samples, 48 kHz) */
+    loadMonitor.init(static_cast<float>(System::GetSysClkFreq()), patch.AudioSampleRate(), patch.AudioBlockSize());
+
     /** Start Processing the audio */
     patch.StartAudio(AudioCallback);
 
@@ -282,14 +325,14 @@ int main(void)
             // // Page 1: parameters retain their previous values
         }
 
-        /* Map normalized control values to actual parameter ranges */
-        predelayTimeCtrl = mapAntiLog(predelayTimeCtrlNorm, 0.0, 100.0);                // 0.0ms - 100.0ms.
-        inputLowpassFcCtrl = mapAntiLog(inputLowpassFcCtrlNorm, 10.0, 22000.0);         // 10.0Hz - 22.0kHz
-        inputHighpassFcCtrl = mapAntiLog(inputHighpassFcCtrlNorm, 10.0, 22000.0);       // 10.0Hz - 22.0kHz
+        /* Map normalized control values to actual parameter ranges (tapers: see controlTapers.hpp) */
+        predelayTimeCtrl = PREDELAY_TIME_TAPER.lookup(predelayTimeCtrlNorm);            // 0.0ms - 100.0ms.
+        inputLowpassFcCtrl = INPUT_FILTER_FC_TAPER.lookup(inputLowpassFcCtrlNorm);      // 10.0Hz - 22.0kHz
+        inputHighpassFcCtrl = INPUT_FILTER_FC_TAPER.lookup(inputHighpassFcCtrlNorm);    // 10.0Hz - 22.0kHz
         driveCtrl = mapLinear(driveCtrlNorm, 0.0, 20.0);                                // 0.0 - 20.0dB
-        hfDampingFcCtrl = mapLog(hfDampingFcCtrlNorm, 20000.0, 400.0);                  // 400Hz - 20.0kHz, inverse mapping
-        lfDampingFcCtrl = mapAntiLog(lfDampingFcCtrlNorm, 10.0, 3000.0);                // 10.0Hz - 3.0kHz
-        mixPercentageCtrl = mapLinear(mixPercentageCtrlNorm, 0.0, 100.0);               // 0.0% - 100.0%
+        hfDampingFcCtrl = HF_DAMPING_FC_TAPER.lookup(hfDampingFcCtrlNorm);              // 400Hz - 20.0kHz (11.0kHz half rate), inverse mapping
+        lfDampingFcCtrl = LF_DAMPING_FC_TAPER.lookup(lfDampingFcCtrlNorm);              // 10.0Hz - 3.0kHz
+        mixPercentageCtrl = mapLinear(mixPercentageCtrlNorm, 0.0, 100.0);               // 0.0% - 100.0% (equal-power law in ReverbZ)
         
         // Set smoothing control
         smoothCtrl = toggleSwitchState;
@@ -306,6 +349,45 @@ int main(void)
                                     mixPercentageCtrl,
                                     smoothCtrl);
 
+        /* ------ Audio callback load on CV_OUT_1: 0V idle, 5V at 100% (a new window every 100 ms) ------ */
+        if (loadMonitor.getTelemetry(loadTelemetry))
+            patch.WriteCvOut(CV_OUT_1, (loadTelemetry.load < 1.0f ? loadTelemetry.load : 1.0f)*maxCvOut);
+
+#ifdef DEBUG
+        /* ------ USB serial reports, about once per second ------ */
+        if (++reportCounter >= reportLoops)
+        {
+            reportCounter = 0;
+            // Load in percent, worst callback since the last report, overruns since start
+            patch.PrintLine("Load %u%% (peak %u%%), worst callback %u%% (%u cycles), %u overruns",
+                            static_cast<unsigned>(loadTelemetry.load*100.0f),
+                            static_cast<unsigned>(loadTelemetry.peakLoad*100.0f),
+                            static_cast<unsigned>(loadTelemetry.worstLoad*100.0f),
+                            static_cast<unsigned>(loadTelemetry.worstCounts),
+                            static_cast<unsigned>(loadTelemetry.overruns));
+            loadMonitor.resetPeaks();
+
+#ifdef PROJLIB_STAGE_PROFILING
+            // ReverbZ stage profile: CPU cycles per sample, since the last report
+            if (reverbz.getProfile(reverbzProfile))
+            {
+                const char* stageNames[ReverbZ_t::kNumProfileStages] = {"input filters", "input diffusers", "mod allpasses", "tank delays",
+                                                                        "saturators", "damping", "smooth allpasses", "output mix"};
+                patch.PrintLine("ReverbZ profile, %u blocks (cycles/sample mean min max):", static_cast<unsigned>(reverbzProfile.blocks));
+                for (std::size_t i = 0; i < ReverbZ_t::kNumProfileStages; i++)
+                {
+                    const StageStats& stats = reverbzProfile.stages[i];
+                    patch.PrintLine("  %s: %u %u %u", stageNames[i],
+                                    static_cast<unsigned>(stats.getMeanPerSample()),
+                                    static_cast<unsigned>(stats.minPerSample),
+                                    static_cast<unsigned>(stats.maxPerSample));
+                }
+                reverbz.resetProfile();
+            }
+#endif
+        }
+#endif
+
         /* ------ LED Blinking based on params page ------ */
         if(paramsPage == 0)      {nBlinksMax = 1;}
         else if(paramsPage == 1) {nBlinksMax = 2;}
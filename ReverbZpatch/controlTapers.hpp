@@ -0,0 +1,40 @@
+#ifndef REVERBZPATCH_CONTROL_TAPERS_HPP
+#define REVERBZPATCH_CONTROL_TAPERS_HPP
+
+#pragma once
+#include "../_projLib/ControlTables.hpp"
+
+
+// Panel tapers of ReverbZpatch: normalized control [0.0 - 1.0] -> parameter value.
+// Tabulated at compile time (256 points, linear interpolation), so the main loop maps
+// the controls without a single pow() call. Host tools include this file to get the
+// very same curves.
+//   anti-log:  a + (b - a)*(10^x - 1)/9     (mapAntiLog)
+//   log:       a*(b/a)^x                    (mapLog)
+// Linear controls (drive, mix) keep mapLinear: a multiply-add needs no table.
+namespace controlTapers {
+
+constexpr double antiLog(double x, double a, double b) { return a + (b - a)*(projLib::constexprMath::pow(10.0, x) - 1.0)/9.0; }
+constexpr double log(double x, double a, double b) { return a*projLib::constexprMath::pow(b/a, x); }
+
+// HF damping top: 20 kHz, or the wet band of HalfRateReverbZ in HALF_RATE=1 builds (0.23*48 kHz),
+// above which it would damp the same
+#ifdef REVERBZ_HALF_RATE
+constexpr double kHfDampingMaxFc = 11000.0;
+#else
+constexpr double kHfDampingMaxFc = 20000.0;
+#endif
+
+constexpr double predelayTime(double x) { return antiLog(x, 0.0, 100.0); }          // 0.0ms - 100.0ms
+constexpr double inputFilterFc(double x) { return antiLog(x, 10.0, 22000.0); }      // 10.0Hz - 22.0kHz, input LP and HP
+constexpr double hfDampingFc(double x) { return log(x, kHfDampingMaxFc, 400.0); }   // 400Hz - 20.0kHz (11.0kHz half rate), inverse mapping
+constexpr double lfDampingFc(double x) { return antiLog(x, 10.0, 3000.0); }         // 10.0Hz - 3.0kHz
+
+}   // namespace controlTapers
+
+constexpr projLib::ControlTable<256> PREDELAY_TIME_TAPER{controlTapers::predelayTime, 0.0, 1.0};
+constexpr projLib::ControlTable<256> INPUT_FILTER_FC_TAPER{controlTapers::inputFilterFc, 0.0, 1.0};
+constexpr projLib::ControlTable<256> HF_DAMPING_FC_TAPER{controlTapers::hfDampingFc, 0.0, 1.0};
+constexpr projLib::ControlTable<256> LF_DAMPING_FC_TAPER{controlTapers::lfDampingFc, 0.0, 1.0};
+
+#endif // REVERBZPATCH_CONTROL_TAPERS_HPP
@@ -9,6 +9,18 @@
 // This is used by RingBuffer, DelayLine, LFO, and AllPass classes
 constexpr std::size_t DSPLIB_MAX_BUFFER_SIZE = 8192;
 
-// TODO: Add sample rate and buffer scale factors?
+// Project sampling frequency. ReverbZ scales its delay lengths to it at compile time
+// and sizes the buffer of every line from them (see ReverbZ::kMemoryBytes).
+constexpr int FS_REVERBZ = 48000;
+
+// ReverbZ predelay buffer: the predelay control spans 0 - 100 ms
+constexpr std::size_t REVERBZ_MAX_PREDELAY_SAMPLES = FS_REVERBZ/10;
+
+// ReverbZ delay memory budget of the internal tiers, in floats. The planner puts the
+// lines accessed most per float in DTCM first, then AXI SRAM; SDRAM takes the rest.
+constexpr std::size_t REVERBZ_DTCM_BUDGET = 8192;         // 32 KB of the 128 KB DTCM (shared with the stack)
+constexpr std::size_t REVERBZ_AXI_SRAM_BUDGET = 16384;    // 64 KB of the 512 KB AXI SRAM
+
+// TODO: Add buffer scale factors?
 
 #endif // REVERBZPATCH_CONFIG_HPP
\ No newline at end of file
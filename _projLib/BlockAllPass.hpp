@@ -0,0 +1,78 @@
+/** -------------------------------------------------------------------------
+    BlockAllPass.hpp - Header file for BlockAllPass class.
+    Fixed-delay Schroeder allpass with a data-parallel block kernel.
+
+    For a block not longer than the delay, w[n-D] of every sample in the
+    block is already in the buffer, so the allpass recursion becomes a plain
+    multiply-add over the block (see blockKernels.hpp). Shorter delays fall
+    back to the per-sample path.
+
+    The buffer is not owned: MaxSamples samples are bound in init(). The
+    RingBuffer parameter selects the storage (BlockRingBuffer by default,
+    SharedRingBuffer for a region of a shared delay memory). With a 16-bit
+    sample format the kernel runs on short float blocks converted from/to
+    the buffer.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef BlockAllPass_hpp
+#define BlockAllPass_hpp
+
+#include <cstddef>
+#include <type_traits>
+#include "BlockRingBuffer.hpp"
+
+namespace projLib {
+
+template<std::size_t MaxSamples, typename RingBuffer = BlockRingBuffer<MaxSamples>>
+class BlockAllPass {
+    public:
+        BlockAllPass();
+        ~BlockAllPass();
+
+        void init(typename RingBuffer::SampleType* buffer);    // bind and clear MaxSamples samples of storage
+        void setDelaySamples(int delaySamples);
+        int getDelaySamples() const;
+        void setFeedbackCoefficient(float feedbackCoefficient);
+
+        // Per-sample processing
+        float processAudio(float inputSample);
+        // Block processing ('input' and 'output' may be the same memory)
+        void processAudio(const float* input, float* output, std::size_t size);
+
+        // Zero 'size' samples of the history the next reads will see, starting 'offset'
+        // samples after the oldest one. Lets an idle allpass be cleared a bit at a time.
+        void clearHistory(std::size_t offset, std::size_t size);
+        // Zero 'size' samples of the history, starting 'offset' samples before the newest one
+        void clearRecent(std::size_t offset, std::size_t size);
+        // Idle allpass: move on 'size' samples as if it had written silence (on a
+        // SharedRingBuffer, call it once the shared memory has advanced)
+        void skipSilence(std::size_t size);
+
+        // Storage access, e.g. to bind a SharedRingBuffer instead of calling init()
+        RingBuffer& getRingBuffer() { return mRingBuffer_; }
+
+    private:
+        // Float storage: the kernel runs in place on the buffer
+        using DirectAccess = std::is_same<typename RingBuffer::SampleType, float>;
+        static constexpr std::size_t kConvertBlockSize = 32;    // float scratch of the converting path
+
+        void processBlockPrivate(const float* input, float* output, std::size_t size, std::true_type);
+        void processBlockPrivate(const float* input, float* output, std::size_t size, std::false_type);
+
+        RingBuffer mRingBuffer_;                    // allpass state w[n], MaxSamples long
+        std::size_t mDelaySamples_;                 // delay in samples [1, MaxSamples-1]
+        float mFeedbackCoefficient_;                // allpass gain g
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "BlockAllPass.tpp"
+
+#endif /* BlockAllPass_hpp */
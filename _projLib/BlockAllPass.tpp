@@ -0,0 +1,159 @@
+/** -------------------------------------------------------------------------
+    BlockAllPass.tpp - Implementation file for BlockAllPass class.
+    Fixed-delay Schroeder allpass with a data-parallel block kernel.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "BlockAllPass.hpp"
+#include "blockKernels.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MaxSamples, typename RingBuffer> constexpr std::size_t BlockAllPass<MaxSamples, RingBuffer>::kConvertBlockSize;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MaxSamples, typename RingBuffer>
+BlockAllPass<MaxSamples, RingBuffer>::BlockAllPass()
+:
+mRingBuffer_(),
+mDelaySamples_(1),
+mFeedbackCoefficient_(0.5f)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+BlockAllPass<MaxSamples, RingBuffer>::~BlockAllPass(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::init(typename RingBuffer::SampleType* buffer)
+{
+    mRingBuffer_.init(buffer);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::setDelaySamples(int delaySamples)
+{
+    // Clamp to the buffer length (an allpass needs at least one sample of delay)
+    if (delaySamples < 1) delaySamples = 1;
+    if (delaySamples > static_cast<int>(MaxSamples) - 1) delaySamples = static_cast<int>(MaxSamples) - 1;
+    mDelaySamples_ = static_cast<std::size_t>(delaySamples);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+int BlockAllPass<MaxSamples, RingBuffer>::getDelaySamples() const
+{
+    return static_cast<int>(mDelaySamples_);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::setFeedbackCoefficient(float feedbackCoefficient)
+{
+    mFeedbackCoefficient_ = feedbackCoefficient;
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+float BlockAllPass<MaxSamples, RingBuffer>::processAudio(float inputSample)
+{
+    float delayOut = mRingBuffer_.read(mDelaySamples_);             // w[n-D]
+    float delayIn = inputSample - delayOut*mFeedbackCoefficient_;   // w[n]
+    mRingBuffer_.write(delayIn);
+    return delayIn*mFeedbackCoefficient_ + delayOut;
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::processAudio(const float* input, float* output, std::size_t size)
+{
+    // Short delay: the block would read samples it writes itself -> scalar fallback
+    if (mDelaySamples_ < size)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = processAudio(input[i]);
+        return;
+    }
+    processBlockPrivate(input, output, size, DirectAccess());
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::clearHistory(std::size_t offset, std::size_t size)
+{
+    // Clip to the delayed region [delay, 1]
+    if (offset >= mDelaySamples_) return;
+    if (size > mDelaySamples_ - offset) size = mDelaySamples_ - offset;
+    mRingBuffer_.clearBlock(mDelaySamples_ - offset, size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::clearRecent(std::size_t offset, std::size_t size)
+{
+    // Clip to the delayed region [delay, 1]
+    if (offset >= mDelaySamples_) return;
+    if (size > mDelaySamples_ - offset) size = mDelaySamples_ - offset;
+    mRingBuffer_.clearBlock(offset + size, size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::skipSilence(std::size_t size)
+{
+    mRingBuffer_.advance(size);
+    clearRecent(0, size);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::processBlockPrivate(const float* input, float* output, std::size_t size, std::true_type)
+{
+    // Run the kernel on segments where neither the read nor the write position wraps
+    float* buffer = mRingBuffer_.getData();
+    std::size_t readIndex = mRingBuffer_.getReadIndex(mDelaySamples_);
+    std::size_t writeIndex = mRingBuffer_.getWriteIndex();
+    std::size_t remaining = size;
+    while (remaining > 0)
+    {
+        std::size_t segment = remaining;
+        if (mRingBuffer_.getContiguousSamples(readIndex) < segment) segment = mRingBuffer_.getContiguousSamples(readIndex);
+        if (mRingBuffer_.getContiguousSamples(writeIndex) < segment) segment = mRingBuffer_.getContiguousSamples(writeIndex);
+
+        allpassKernel(input, buffer + readIndex, buffer + writeIndex, output, mFeedbackCoefficient_, segment);
+
+        input += segment;
+        output += segment;
+        remaining -= segment;
+        readIndex = mRingBuffer_.wrapIndex(readIndex + segment);
+        writeIndex = mRingBuffer_.wrapIndex(writeIndex + segment);
+    }
+    mRingBuffer_.advance(size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockAllPass<MaxSamples, RingBuffer>::processBlockPrivate(const float* input, float* output, std::size_t size, std::false_type)
+{
+    // Converted storage: decode w[n-D] of a short block, run the kernel into float
+    // scratch, encode w[n] back (the block never reads what it writes: delay >= size)
+    float delayed[kConvertBlockSize];
+    float state[kConvertBlockSize];
+    while (size > 0)
+    {
+        const std::size_t segment = (size < kConvertBlockSize) ? size : kConvertBlockSize;
+        mRingBuffer_.readBlock(mDelaySamples_, delayed, segment);
+        allpassKernel(input, delayed, state, output, mFeedbackCoefficient_, segment);
+        mRingBuffer_.writeBlock(state, segment);
+
+        input += segment;
+        output += segment;
+        size -= segment;
+    }
+}
+
+}   // namespace projLib
@@ -0,0 +1,79 @@
+/** -------------------------------------------------------------------------
+    BlockDelayLine.hpp - Header file for BlockDelayLine class.
+    Fixed delay line with split read/write access, for block processing.
+
+    Unlike dspLib::DelayLine, reading the delayed samples of a whole block
+    and writing the new input block are separate calls. As long as the block
+    is not longer than the delay, the outputs of a block can be read before
+    its inputs have been computed (needed to schedule a feedback loop
+    stage by stage).
+
+    The buffer is not owned: MaxSamples samples are bound in init(), so the
+    object itself can stay in internal RAM while the samples live in SDRAM.
+    The RingBuffer parameter selects the storage and its sample format.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef BlockDelayLine_hpp
+#define BlockDelayLine_hpp
+
+#include <cstddef>
+#include <type_traits>
+#include "BlockRingBuffer.hpp"
+
+namespace projLib {
+
+template<std::size_t MaxSamples, typename RingBuffer = BlockRingBuffer<MaxSamples>>
+class BlockDelayLine {
+    public:
+        BlockDelayLine();
+        ~BlockDelayLine();
+
+        void init(typename RingBuffer::SampleType* buffer);    // bind and clear MaxSamples samples of storage
+        void setDelaySamples(int delaySamples);
+        int getDelaySamples() const;
+
+        // Per-sample processing: read the delayed sample, then write the input
+        float processAudio(float inputSample);
+        // Block processing ('input' and 'output' may be the same memory)
+        void processAudio(const float* input, float* output, std::size_t size);
+
+        // Block access. read() returns the next 'size' delayed samples without
+        // advancing, write() pushes 'size' input samples and advances.
+        // read() before write() is only valid for size <= delay samples.
+        void read(float* output, std::size_t size) const;
+        void write(const float* input, std::size_t size);
+
+        // Zero 'size' samples of the history the next reads will see, starting 'offset'
+        // samples after the oldest one. Lets an idle line be cleared a bit at a time.
+        void clearHistory(std::size_t offset, std::size_t size);
+        // Zero 'size' samples of the buffer, whatever the delay, starting 'offset' samples
+        // before the newest one (a line held at 0 delay is not written). Per-line storage only.
+        void clearBuffer(std::size_t offset, std::size_t size);
+
+        // Storage access, e.g. to bind a SharedRingBuffer instead of calling init()
+        RingBuffer& getRingBuffer() { return mRingBuffer_; }
+
+    private:
+        // Float storage: the delayed block is copied straight out of the buffer
+        using DirectAccess = std::is_same<typename RingBuffer::SampleType, float>;
+        static constexpr std::size_t kConvertBlockSize = 32;    // float scratch of the converting path
+
+        void processBlockPrivate(const float* input, float* output, std::size_t size, std::true_type);
+        void processBlockPrivate(const float* input, float* output, std::size_t size, std::false_type);
+
+        RingBuffer mRingBuffer_;                    // external storage, MaxSamples long
+        std::size_t mDelaySamples_;                 // delay in samples [0, MaxSamples-1]
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "BlockDelayLine.tpp"
+
+#endif /* BlockDelayLine_hpp */
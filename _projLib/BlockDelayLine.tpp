@@ -0,0 +1,155 @@
+/** -------------------------------------------------------------------------
+    BlockDelayLine.tpp - Implementation file for BlockDelayLine class.
+    Fixed delay line with split read/write access, for block processing.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "BlockDelayLine.hpp"
+#include <cstring>
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MaxSamples, typename RingBuffer> constexpr std::size_t BlockDelayLine<MaxSamples, RingBuffer>::kConvertBlockSize;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MaxSamples, typename RingBuffer>
+BlockDelayLine<MaxSamples, RingBuffer>::BlockDelayLine()
+:
+mRingBuffer_(),
+mDelaySamples_(0)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+BlockDelayLine<MaxSamples, RingBuffer>::~BlockDelayLine(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::init(typename RingBuffer::SampleType* buffer)
+{
+    mRingBuffer_.init(buffer);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::setDelaySamples(int delaySamples)
+{
+    // Clamp to the buffer length
+    if (delaySamples < 0) delaySamples = 0;
+    if (delaySamples > static_cast<int>(MaxSamples) - 1) delaySamples = static_cast<int>(MaxSamples) - 1;
+    mDelaySamples_ = static_cast<std::size_t>(delaySamples);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+int BlockDelayLine<MaxSamples, RingBuffer>::getDelaySamples() const
+{
+    return static_cast<int>(mDelaySamples_);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+float BlockDelayLine<MaxSamples, RingBuffer>::processAudio(float inputSample)
+{
+    // Zero delay: pass the input through (the read would return the oldest sample)
+    if (mDelaySamples_ == 0) return inputSample;
+
+    float outputSample = mRingBuffer_.read(mDelaySamples_);
+    mRingBuffer_.write(inputSample);
+    return outputSample;
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::processAudio(const float* input, float* output, std::size_t size)
+{
+    // Short delay (the block would read samples it writes itself) or not enough
+    // headroom to write the block ahead of the read position -> scalar fallback
+    if (mDelaySamples_ < size || size > MaxSamples - mDelaySamples_)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = processAudio(input[i]);
+        return;
+    }
+    processBlockPrivate(input, output, size, DirectAccess());
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::read(float* output, std::size_t size) const
+{
+    mRingBuffer_.readBlock(mDelaySamples_, output, size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::write(const float* input, std::size_t size)
+{
+    mRingBuffer_.writeBlock(input, size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::clearHistory(std::size_t offset, std::size_t size)
+{
+    // Clip to the delayed region [delay, 1]
+    if (offset >= mDelaySamples_) return;
+    if (size > mDelaySamples_ - offset) size = mDelaySamples_ - offset;
+    mRingBuffer_.clearBlock(mDelaySamples_ - offset, size);
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::clearBuffer(std::size_t offset, std::size_t size)
+{
+    // Clip to the buffer [1, MaxSamples]
+    if (offset >= MaxSamples) return;
+    if (size > MaxSamples - offset) size = MaxSamples - offset;
+    mRingBuffer_.clearBlock(offset + size, size);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::processBlockPrivate(const float* input, float* output, std::size_t size, std::true_type)
+{
+    // Read and write regions do not overlap: write first (input may alias output),
+    // then copy the delayed samples out from the read position before the write.
+    const std::size_t readIndex = mRingBuffer_.getReadIndex(mDelaySamples_);
+    mRingBuffer_.writeBlock(input, size);
+
+    const float* buffer = mRingBuffer_.getData();
+    std::size_t index = readIndex;
+    while (size > 0)
+    {
+        std::size_t segment = mRingBuffer_.getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memcpy(output, buffer + index, segment*sizeof(float));
+        output += segment;
+        size -= segment;
+        index = 0;
+    }
+}
+
+template<std::size_t MaxSamples, typename RingBuffer>
+void BlockDelayLine<MaxSamples, RingBuffer>::processBlockPrivate(const float* input, float* output, std::size_t size, std::false_type)
+{
+    // Converted storage: decode the delayed samples of a short block into scratch
+    // before encoding its input (input may alias output)
+    float delayed[kConvertBlockSize];
+    while (size > 0)
+    {
+        const std::size_t segment = (size < kConvertBlockSize) ? size : kConvertBlockSize;
+        mRingBuffer_.readBlock(mDelaySamples_, delayed, segment);
+        mRingBuffer_.writeBlock(input, segment);
+        memcpy(output, delayed, segment*sizeof(float));
+
+        input += segment;
+        output += segment;
+        size -= segment;
+    }
+}
+
+}   // namespace projLib
@@ -0,0 +1,68 @@
+/** -------------------------------------------------------------------------
+    BlockRingBuffer.hpp - Header file for BlockRingBuffer class.
+    Circular buffer on external storage, with per-sample and block access.
+
+    Shared storage/indexing layer of BlockDelayLine and BlockAllPass. Block
+    access is exposed as contiguous segments (index + length before the end
+    of the buffer), so the block kernels can run on plain pointers.
+
+    The buffer is not owned: MaxSamples samples are bound in init(). The
+    Format parameter selects the sample storage (see SampleFormat.hpp):
+    float by default, 16-bit formats convert on every read and write.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef BlockRingBuffer_hpp
+#define BlockRingBuffer_hpp
+
+#include <cstddef>
+#include "SampleFormat.hpp"
+
+namespace projLib {
+
+template<std::size_t MaxSamples, typename Format = Float32Format>
+class BlockRingBuffer {
+    public:
+        using SampleType = typename Format::Type;
+
+        BlockRingBuffer();
+        ~BlockRingBuffer();
+
+        void init(SampleType* buffer);              // bind and clear MaxSamples samples of storage
+
+        // Index of the sample written 'delaySamples' writes ago (0 = the next write position)
+        std::size_t getReadIndex(std::size_t delaySamples) const;
+        std::size_t getWriteIndex() const { return mWriteIndex_; }
+        // Samples from 'index' to the end of the buffer
+        std::size_t getContiguousSamples(std::size_t index) const { return MaxSamples - index; }
+        // Wrap an index at most one buffer length past the end
+        std::size_t wrapIndex(std::size_t index) const { return (index >= MaxSamples) ? index - MaxSamples : index; }
+        SampleType* getData() const { return mBuffer_; }
+
+        // Per-sample access
+        float read(std::size_t delaySamples) const { return Format::decode(mBuffer_[getReadIndex(delaySamples)]); }
+        void write(float inputSample);
+
+        // Block access. readBlock() does not advance, writeBlock() and advance() do.
+        void readBlock(std::size_t delaySamples, float* output, std::size_t size) const;
+        void writeBlock(const float* input, std::size_t size);
+        // Zero the 'size' samples readBlock() would return for the same arguments
+        void clearBlock(std::size_t delaySamples, std::size_t size);
+        void advance(std::size_t size);
+
+    private:
+        SampleType* mBuffer_;                       // external storage, MaxSamples long
+        std::size_t mWriteIndex_;                   // next write position
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "BlockRingBuffer.tpp"
+
+#endif /* BlockRingBuffer_hpp */
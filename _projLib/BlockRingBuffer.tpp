@@ -0,0 +1,111 @@
+/** -------------------------------------------------------------------------
+    BlockRingBuffer.tpp - Implementation file for BlockRingBuffer class.
+    Circular buffer on external storage, with per-sample and block access.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "BlockRingBuffer.hpp"
+#include <cstring>
+
+namespace projLib {
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MaxSamples, typename Format>
+BlockRingBuffer<MaxSamples, Format>::BlockRingBuffer()
+:
+mBuffer_(nullptr),
+mWriteIndex_(0)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MaxSamples, typename Format>
+BlockRingBuffer<MaxSamples, Format>::~BlockRingBuffer(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::init(SampleType* buffer)
+{
+    // Bind external storage and clear it (SDRAM is not zeroed at startup)
+    mBuffer_ = buffer;
+    memset(mBuffer_, 0, MaxSamples*sizeof(SampleType));
+    mWriteIndex_ = 0;
+}
+
+template<std::size_t MaxSamples, typename Format>
+std::size_t BlockRingBuffer<MaxSamples, Format>::getReadIndex(std::size_t delaySamples) const
+{
+    return (mWriteIndex_ >= delaySamples) ? mWriteIndex_ - delaySamples
+                                          : mWriteIndex_ + MaxSamples - delaySamples;
+}
+
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::write(float inputSample)
+{
+    // Write and wrap write position
+    mBuffer_[mWriteIndex_] = Format::encode(inputSample);
+    if (++mWriteIndex_ >= MaxSamples) mWriteIndex_ = 0;
+}
+
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::readBlock(std::size_t delaySamples, float* output, std::size_t size) const
+{
+    std::size_t readIndex = getReadIndex(delaySamples);
+    // Convert up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(readIndex);
+        if (segment > size) segment = size;
+        Format::decode(mBuffer_ + readIndex, output, segment);
+        output += segment;
+        size -= segment;
+        readIndex = 0;
+    }
+}
+
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::writeBlock(const float* input, std::size_t size)
+{
+    // Convert up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(mWriteIndex_);
+        if (segment > size) segment = size;
+        Format::encode(input, mBuffer_ + mWriteIndex_, segment);
+        input += segment;
+        size -= segment;
+        advance(segment);
+    }
+}
+
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::clearBlock(std::size_t delaySamples, std::size_t size)
+{
+    std::size_t index = getReadIndex(delaySamples);
+    // Clear up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memset(mBuffer_ + index, 0, segment*sizeof(SampleType));
+        size -= segment;
+        index = 0;
+    }
+}
+
+template<std::size_t MaxSamples, typename Format>
+void BlockRingBuffer<MaxSamples, Format>::advance(std::size_t size)
+{
+    mWriteIndex_ += size;
+    if (mWriteIndex_ >= MaxSamples) mWriteIndex_ -= MaxSamples;
+}
+
+}   // namespace projLib
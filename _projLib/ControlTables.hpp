@@ -0,0 +1,109 @@
+/** -------------------------------------------------------------------------
+    ControlTables.hpp - Compile-time lookup tables for control mapping.
+    ControlTable class and the curves shared by the firmware and host tools.
+
+    A ControlTable samples a constexpr curve at Size + 1 evenly spaced points
+    over [from, to] when the program is compiled (constexprMath.hpp), and
+    maps a value by linear interpolation, clamped to the range. A lookup is
+    a multiply, a truncation and a multiply-add: no libm call, so control
+    values can be cooked at any rate, in any thread.
+
+    Shared curves (max abs error of the lookup against the exact curve):
+        onePoleFeedback()   exp(-wc), wc in [0, pi] (1024 points): 1.2e-6,
+                            under 0.03% of the cutoff from 1 Hz up
+        equalPowerGains()   sin/cos mix law, -3 dB at the middle (256
+                            points): 5e-6, both ends exact
+
+    Panel tapers of a project are built the same way from its own curves
+    (e.g. ReverbZpatch/controlTapers.hpp).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef ControlTables_hpp
+#define ControlTables_hpp
+
+#include <cstddef>
+#include "constexprMath.hpp"
+
+namespace projLib {
+
+// Curve sampled by a ControlTable (constexpr: evaluated at compile time only)
+using ControlCurve = double (*)(double);
+
+template<std::size_t Size>
+class ControlTable {
+    public:
+        constexpr ControlTable(ControlCurve curve, double from, double to)
+        :
+        mValues_(),
+        mFrom_(static_cast<float>(from)),
+        mScale_(static_cast<float>(Size/(to - from)))
+        {
+            for (std::size_t i = 0; i <= Size; i++)
+                mValues_[i] = static_cast<float>(curve(from + (to - from)*static_cast<double>(i)/static_cast<double>(Size)));
+            mValues_[Size + 1] = mValues_[Size];        // guard point: the top of the range interpolates to it
+        }
+
+        // Curve at 'x', clamped to [from, to]
+        float lookup(float x) const
+        {
+            float position = (x - mFrom_)*mScale_;
+            if (position < 0.0f) position = 0.0f;
+            if (position > static_cast<float>(Size)) position = static_cast<float>(Size);
+            const std::size_t index = static_cast<std::size_t>(position);
+            const float fraction = position - static_cast<float>(index);
+            return mValues_[index] + fraction*(mValues_[index + 1] - mValues_[index]);
+        }
+
+    private:
+        float mValues_[Size + 2];
+        float mFrom_;
+        float mScale_;                                  // table points per unit of x
+};
+
+/* -------------------------------------------------------------------------- */
+/*                                Shared curves                               */
+/* -------------------------------------------------------------------------- */
+namespace controlCurves {
+
+// Feedback coefficient of a one-pole filter at normalised cutoff wc = 2*pi*fc/fs
+constexpr double onePoleFeedback(double wc) { return constexprMath::exp(-wc); }
+// Equal-power crossfade gain of the faded-in signal, mix in [0, 1]
+constexpr double equalPowerGain(double mix) { return constexprMath::sin(0.5*constexprMath::kPi*mix); }
+
+}   // namespace controlCurves
+
+// Shared tables (a class template: one definition whatever the number of translation units)
+template<typename Unused = void>
+struct SharedControlTables {
+    static constexpr ControlTable<1024> kOnePoleFeedback{controlCurves::onePoleFeedback, 0.0, constexprMath::kPi};
+    static constexpr ControlTable<256> kEqualPower{controlCurves::equalPowerGain, 0.0, 1.0};
+};
+template<typename Unused> constexpr ControlTable<1024> SharedControlTables<Unused>::kOnePoleFeedback;
+template<typename Unused> constexpr ControlTable<256> SharedControlTables<Unused>::kEqualPower;
+
+// Feedback coefficient for a normalised cutoff in [0, pi] (see FastOnePole)
+inline float onePoleFeedback(float wc)
+{
+    // Below the first table step the curve bends too much for the interpolation:
+    // 1 - wc + wc^2/2 - wc^3/6 is exact to wc^4/24 there.
+    constexpr float kSeriesLimit = static_cast<float>(constexprMath::kPi/1024.0);
+    if (wc < kSeriesLimit) return 1.0f - wc*(1.0f - wc*(0.5f - wc*(1.0f/6.0f)));
+    return SharedControlTables<>::kOnePoleFeedback.lookup(wc);
+}
+
+// Equal-power dry/wet gains for a mix in [0, 1] (0: dry only, 1: wet only)
+inline void equalPowerGains(float mix, float& dryGain, float& wetGain)
+{
+    wetGain = SharedControlTables<>::kEqualPower.lookup(mix);
+    dryGain = SharedControlTables<>::kEqualPower.lookup(1.0f - mix);
+}
+
+}   // namespace projLib
+
+#endif /* ControlTables_hpp */
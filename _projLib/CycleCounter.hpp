@@ -0,0 +1,118 @@
+/** -------------------------------------------------------------------------
+    CycleCounter.hpp - Header file for CycleCounter class.
+    Free-running cycle counter for the profiling probes.
+
+    now() reads the cheapest fine-grained counter of the target:
+
+        Cortex-M7 (Patch SM):   DWT CYCCNT, core cycles (32-bit, wraps
+                                every ~9 s at 480 MHz)
+        x86-64 (host tools):    TSC (rdtsc), reference cycles
+        AArch64:                virtual counter (CNTVCT_EL0), timer ticks
+        other POSIX hosts:      clock_gettime(CLOCK_MONOTONIC), ns
+
+    Intervals are taken as the wrapping difference of two readings, so a
+    32-bit counter is fine for anything shorter than its wrap period.
+    enable() must be called once before the first reading: it starts the
+    DWT counter on Cortex-M (the debug unit is off after reset), and does
+    nothing elsewhere.
+
+    Hardware-specific implementation (debug unit registers, counter
+    instructions).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef CycleCounter_hpp
+#define CycleCounter_hpp
+
+#include <cstdint>
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#define PROJLIB_CYCLE_COUNTER_DWT
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define PROJLIB_CYCLE_COUNTER_TSC
+#include <x86intrin.h>
+#elif defined(__aarch64__)
+#define PROJLIB_CYCLE_COUNTER_CNTVCT
+#else
+#include <time.h>
+#endif
+
+namespace projLib {
+
+class CycleCounter {
+    public:
+#if defined(PROJLIB_CYCLE_COUNTER_DWT)
+        using Count = std::uint32_t;
+#else
+        using Count = std::uint64_t;
+#endif
+
+        static void enable();
+        static Count now();
+        // Counts elapsed from 'start' to 'end' (wrapping)
+        static Count elapsed(Count start, Count end) { return end - start; }
+
+    private:
+#if defined(PROJLIB_CYCLE_COUNTER_DWT)
+        // Cortex-M debug registers (ARMv7-M architecture reference manual)
+        static constexpr std::uintptr_t kDemcr = 0xE000EDFC;        // debug exception and monitor control
+        static constexpr std::uintptr_t kDwtControl = 0xE0001000;
+        static constexpr std::uintptr_t kDwtCycleCount = 0xE0001004;
+        static constexpr std::uintptr_t kDwtLockAccess = 0xE0001FB0;     // Cortex-M7: write-locked after reset
+        static constexpr std::uint32_t kDemcrTraceEnable = 1u << 24;    // TRCENA
+        static constexpr std::uint32_t kDwtCycleCountEnable = 1u << 0;  // CYCCNTENA
+        static constexpr std::uint32_t kDwtUnlockKey = 0xC5ACCE55;
+
+        static volatile std::uint32_t& reg(std::uintptr_t address) { return *reinterpret_cast<volatile std::uint32_t*>(address); }
+#endif
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+#if defined(PROJLIB_CYCLE_COUNTER_DWT)
+inline void CycleCounter::enable()
+{
+    reg(kDemcr) |= kDemcrTraceEnable;
+    reg(kDwtLockAccess) = kDwtUnlockKey;
+    reg(kDwtCycleCount) = 0;
+    reg(kDwtControl) |= kDwtCycleCountEnable;
+}
+
+inline CycleCounter::Count CycleCounter::now()
+{
+    return reg(kDwtCycleCount);
+}
+#elif defined(PROJLIB_CYCLE_COUNTER_TSC)
+inline void CycleCounter::enable(){}
+
+inline CycleCounter::Count CycleCounter::now()
+{
+    return __rdtsc();
+}
+#elif defined(PROJLIB_CYCLE_COUNTER_CNTVCT)
+inline void CycleCounter::enable(){}
+
+inline CycleCounter::Count CycleCounter::now()
+{
+    std::uint64_t count;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(count));
+    return count;
+}
+#else
+inline void CycleCounter::enable(){}
+
+inline CycleCounter::Count CycleCounter::now()
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<Count>(time.tv_sec)*1000000000u + static_cast<Count>(time.tv_nsec);
+}
+#endif
+
+}   // namespace projLib
+
+#endif /* CycleCounter_hpp */
@@ -0,0 +1,116 @@
+/** -------------------------------------------------------------------------
+    DenormalGuard.hpp - Header file for DenormalGuard class.
+    Flush-to-zero scope for the audio processing.
+
+    A decaying feedback loop (reverb tank, one-pole filter states) ends up on
+    subnormal floats once the input stops. On the host FPU every operation
+    on a subnormal takes a slow microcode path, so the CPU load climbs while
+    the output is silent. The guard switches the FPU to flush subnormal
+    results (and inputs, where the FPU supports it) to zero for its
+    lifetime, and restores the previous mode when it goes out of scope:
+
+        x86 SSE:             MXCSR FTZ + DAZ
+        ARM VFP (Cortex-M7): FPSCR FZ (flushes inputs and results)
+        AArch64:             FPCR FZ
+
+    Other targets compile to nothing: flushDenormal() is the portable
+    fallback for state carried from one block to the next.
+
+    Hardware-specific implementation (FPU control registers).
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef DenormalGuard_hpp
+#define DenormalGuard_hpp
+
+#include <cstdint>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace projLib {
+
+// Zero a value that is about to become subnormal (same job as the legacy DeZipper check)
+constexpr float kDenormalThreshold = 1.0e-30f;
+inline float flushDenormal(float value)
+{
+    return (std::fabs(value) < kDenormalThreshold) ? 0.0f : value;
+}
+
+class DenormalGuard {
+    public:
+        DenormalGuard();
+        ~DenormalGuard();
+
+        DenormalGuard(const DenormalGuard&) = delete;
+        DenormalGuard& operator=(const DenormalGuard&) = delete;
+
+    private:
+#if defined(__SSE__) || defined(_M_X64)
+        static constexpr unsigned int kFlushBits = 0x8040;          // MXCSR FTZ (bit 15) | DAZ (bit 6)
+        unsigned int mSavedControl_;
+#elif defined(__aarch64__)
+        static constexpr std::uint64_t kFlushBits = 1ull << 24;     // FPCR FZ
+        std::uint64_t mSavedControl_;
+#elif defined(__arm__) && defined(__ARM_FP)
+        static constexpr std::uint32_t kFlushBits = 1u << 24;       // FPSCR FZ
+        std::uint32_t mSavedControl_;
+#endif
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+#if defined(__SSE__) || defined(_M_X64)
+inline DenormalGuard::DenormalGuard()
+:
+mSavedControl_(_mm_getcsr())
+{
+    _mm_setcsr(mSavedControl_ | kFlushBits);
+}
+
+inline DenormalGuard::~DenormalGuard()
+{
+    _mm_setcsr(mSavedControl_);
+}
+#elif defined(__aarch64__)
+inline DenormalGuard::DenormalGuard()
+{
+    std::uint64_t control;
+    __asm__ volatile("mrs %0, fpcr" : "=r"(control));
+    mSavedControl_ = control;
+    control |= kFlushBits;
+    __asm__ volatile("msr fpcr, %0" : : "r"(control));
+}
+
+inline DenormalGuard::~DenormalGuard()
+{
+    __asm__ volatile("msr fpcr, %0" : : "r"(mSavedControl_));
+}
+#elif defined(__arm__) && defined(__ARM_FP)
+inline DenormalGuard::DenormalGuard()
+{
+    std::uint32_t control;
+    __asm__ volatile("vmrs %0, fpscr" : "=r"(control));
+    mSavedControl_ = control;
+    control |= kFlushBits;
+    __asm__ volatile("vmsr fpscr, %0" : : "r"(control));
+}
+
+inline DenormalGuard::~DenormalGuard()
+{
+    __asm__ volatile("vmsr fpscr, %0" : : "r"(mSavedControl_));
+}
+#else
+inline DenormalGuard::DenormalGuard(){}
+inline DenormalGuard::~DenormalGuard(){}
+#endif
+
+}   // namespace projLib
+
+#endif /* DenormalGuard_hpp */
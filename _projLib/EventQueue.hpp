@@ -0,0 +1,71 @@
+/** -------------------------------------------------------------------------
+    EventQueue.hpp - Header file for EventQueue class.
+    Fixed-capacity queue of timestamped events, kept in time order.
+
+    Every event carries a sample offset from the start of the next processed
+    block. push() inserts it behind the events due at the same time or
+    earlier (events never come out of order, simultaneous ones come out in
+    the order they were pushed). The block processor splits its block at
+    nextOffset(), pops the events due at the split (isDue()) and, once the
+    whole block is processed, moves the remaining ones forward with
+    advance(): an event past the end of a block waits for the block it
+    falls in.
+
+    The events live in a power-of-two ring inside the object: no allocation,
+    push() fails when the queue is full. Not thread safe: pushed and popped
+    from the same thread (the audio thread, before the block the offsets
+    refer to).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef EventQueue_hpp
+#define EventQueue_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+// Event: trivially copyable, with a std::size_t sampleOffset member
+template<typename Event, std::size_t Capacity>
+class EventQueue {
+    public:
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "EventQueue: capacity must be a power of two");
+
+        EventQueue();
+        ~EventQueue();
+
+        void clear();
+        // Insert in time order. false: the queue is full, the event is dropped.
+        bool push(const Event& event);
+
+        // The next event is due at (or before) 'offset' into the current block
+        bool isDue(std::size_t offset) const { return mCount_ > 0 && mEvents_[mHead_].sampleOffset <= offset; }
+        // Offset of the next event, 'limit' if there is none before it
+        std::size_t nextOffset(std::size_t limit) const;
+        const Event& front() const { return mEvents_[mHead_]; }
+        void pop();
+        // The current block is done: offsets of the events left move on by its 'size'
+        void advance(std::size_t size);
+
+        std::size_t getCount() const { return mCount_; }
+        bool isEmpty() const { return mCount_ == 0; }
+
+    private:
+        static constexpr std::size_t kMask = Capacity - 1;
+
+        Event mEvents_[Capacity];                   // ring, sorted by sampleOffset from mHead_
+        std::size_t mHead_;
+        std::size_t mCount_;
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "EventQueue.tpp"
+
+#endif /* EventQueue_hpp */
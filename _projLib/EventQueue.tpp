@@ -0,0 +1,88 @@
+/** -------------------------------------------------------------------------
+    EventQueue.tpp - Implementation file for EventQueue class.
+    Fixed-capacity queue of timestamped events, kept in time order.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "EventQueue.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<typename Event, std::size_t Capacity> constexpr std::size_t EventQueue<Event, Capacity>::kMask;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<typename Event, std::size_t Capacity>
+EventQueue<Event, Capacity>::EventQueue()
+:
+mEvents_(),
+mHead_(0),
+mCount_(0)
+{}
+/* ------------------------------- Destructor ------------------------------- */
+template<typename Event, std::size_t Capacity>
+EventQueue<Event, Capacity>::~EventQueue(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<typename Event, std::size_t Capacity>
+void EventQueue<Event, Capacity>::clear()
+{
+    mHead_ = 0;
+    mCount_ = 0;
+}
+
+template<typename Event, std::size_t Capacity>
+bool EventQueue<Event, Capacity>::push(const Event& event)
+{
+    if (mCount_ == Capacity) return false;
+
+    // Shift the later events up one slot, from the back: events usually come in
+    // time order, and then nothing moves
+    std::size_t position = mCount_;
+    while (position > 0)
+    {
+        const Event& previous = mEvents_[(mHead_ + position - 1) & kMask];
+        if (previous.sampleOffset <= event.sampleOffset) break;
+        mEvents_[(mHead_ + position) & kMask] = previous;
+        position--;
+    }
+    mEvents_[(mHead_ + position) & kMask] = event;
+    mCount_++;
+    return true;
+}
+
+template<typename Event, std::size_t Capacity>
+std::size_t EventQueue<Event, Capacity>::nextOffset(std::size_t limit) const
+{
+    if (mCount_ == 0 || mEvents_[mHead_].sampleOffset >= limit) return limit;
+    return mEvents_[mHead_].sampleOffset;
+}
+
+template<typename Event, std::size_t Capacity>
+void EventQueue<Event, Capacity>::pop()
+{
+    if (mCount_ == 0) return;
+    mHead_ = (mHead_ + 1) & kMask;
+    mCount_--;
+}
+
+template<typename Event, std::size_t Capacity>
+void EventQueue<Event, Capacity>::advance(std::size_t size)
+{
+    // Events left behind (none when every due one was popped) are due at once
+    for (std::size_t i = 0; i < mCount_; i++)
+    {
+        Event& event = mEvents_[(mHead_ + i) & kMask];
+        event.sampleOffset = (event.sampleOffset > size) ? event.sampleOffset - size : 0;
+    }
+}
+
+}   // namespace projLib
@@ -0,0 +1,80 @@
+/** -------------------------------------------------------------------------
+    FastOnePole.hpp - Header file for FastOnePole class.
+    One-pole lowpass / highpass set by its feedback coefficient.
+
+    Same filters as the legacy ReverbZ LowPass / HighPass, with the
+    coefficient b = exp(-wc) computed by the caller (e.g. onePoleFeedback()
+    in ControlTables.hpp, on the control thread) instead of on every
+    coefficient update:
+        lowpass   l[n] = (1 - b)*x[n] + b*l[n-1]
+        highpass  y[n] = x[n] - l[n-1]
+    i.e. (1 - z^-1)/(1 - b*z^-1) for the highpass: exact zero at DC. (The
+    legacy code kept m = l/(1 - b), which grows without bound at b = 1.)
+    An instance is used either as a lowpass or as a highpass.
+    Both have an exact identity setting: b = 0 for the lowpass, b = 1 from
+    a cleared state for the highpass (the state stays at 0).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef FastOnePole_hpp
+#define FastOnePole_hpp
+
+namespace projLib {
+
+class FastOnePole {
+    public:
+        FastOnePole();
+        ~FastOnePole();
+
+        void setFeedbackCoefficient(float feedbackCoefficient);    // b in [0, 1]: identity at 0 (LP) or 1 (HP)
+        float getFeedbackCoefficient() const { return mFeedback_; }
+        void reset() { mState_ = 0.0f; }
+
+        float processAudioLP(float inputSample);
+        float processAudioHP(float inputSample);
+
+    private:
+        float mFeedback_;                           // b
+        float mGain_;                               // 1 - b
+        float mState_;                              // l[n-1]
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline FastOnePole::FastOnePole()
+:
+mFeedback_(0.0f),
+mGain_(1.0f),
+mState_(0.0f)
+{}
+
+inline FastOnePole::~FastOnePole(){}
+
+inline void FastOnePole::setFeedbackCoefficient(float feedbackCoefficient)
+{
+    mFeedback_ = feedbackCoefficient;
+    mGain_ = 1.0f - feedbackCoefficient;
+}
+
+inline float FastOnePole::processAudioLP(float inputSample)
+{
+    mState_ = mGain_*inputSample + mFeedback_*mState_;
+    return mState_;
+}
+
+inline float FastOnePole::processAudioHP(float inputSample)
+{
+    const float outputSample = inputSample - mState_;
+    mState_ = mGain_*inputSample + mFeedback_*mState_;
+    return outputSample;
+}
+
+}   // namespace projLib
+
+#endif /* FastOnePole_hpp */
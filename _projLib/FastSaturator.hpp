@@ -0,0 +1,137 @@
+/** -------------------------------------------------------------------------
+    FastSaturator.hpp - Header file for FastSaturator class.
+    Atan/tanh saturation curves of the ReverbZ tank, with fast kernels.
+
+    Same curves as the legacy ReverbZ Saturator: drive in dB, output
+    normalised to avoid a volume increase (empirical factors):
+        atan(x*d)/((0.9 + 0.1*d)*atan(d))     (d >= 1, else atan(x*d)/atan(d))
+        tanh(x*d)/((0.7 + 0.3*d)*tanh(d))     (d >= 1, else tanh(x*d)/tanh(d))
+    The drive gain and both normalisations are computed in setDrive(), only
+    when the drive changes: processing is one multiply, the curve, and one
+    multiply. computeDrive() cooks them on their own (e.g. outside the audio
+    thread), for setDrive(const DriveCoefficients&): from compile-time tables
+    over [0, kDriveTableRange] dB (relative error < 2e-5), with libm outside.
+
+    Curve kernels (max abs error of the unnormalised curve, float):
+        Exact     std::atan / std::tanh
+        Rational  atan: odd polynomial on [-1, 1], pi/2 - atan(1/x) outside
+                  (one divide), 2e-7. tanh: Lambert's continued fraction
+                  truncated to 7/6 (one divide), clamped to +/-1 from
+                  |x| = kTanhClamp: 1e-6 below |x| = 3, 1e-4 at the clamp.
+        Table     TableSize-point tables over [0, kTableRange], generated at
+                  compile time and read with linear interpolation: 2.5e-5
+                  for TableSize 512. atan tail: pi/2 - 1/x + 1/(3x^3).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef FastSaturator_hpp
+#define FastSaturator_hpp
+
+#include <cstddef>
+#include <cmath>
+#include "constexprMath.hpp"
+#include "ControlTables.hpp"
+
+namespace projLib {
+
+// Curve evaluation of a FastSaturator
+enum class SaturatorKernel {
+    Exact,          // libm calls
+    Rational,       // polynomial / rational approximations
+    Table           // compile-time tables, linear interpolation
+};
+
+// atan and tanh sampled over [0, Range] (odd curves: the negative half is mirrored).
+// One guard point past the end for the interpolation.
+template<std::size_t Size>
+struct SaturatorTables {
+    float atanCurve[Size + 2];
+    float tanhCurve[Size + 2];
+
+    constexpr SaturatorTables(double range)
+    :
+    atanCurve(),
+    tanhCurve()
+    {
+        for (std::size_t i = 0; i < Size + 2; i++)
+        {
+            const double x = range*static_cast<double>(i)/static_cast<double>(Size);
+            atanCurve[i] = static_cast<float>(constexprMath::atan(x));
+            tanhCurve[i] = static_cast<float>(constexprMath::tanh(x));
+        }
+    }
+};
+
+template<std::size_t TableSize = 512>
+class FastSaturator {
+    public:
+        static constexpr float kTableRange = 8.0f;          // tanh(8) = 1 - 2.3e-7
+        static constexpr float kTanhClamp = 4.97f;          // rational and clamp errors balance here
+        static constexpr float kDriveTableRange = 24.0f;    // dB covered by the drive tables
+
+        // Everything a drive setting needs (pow, atan and tanh to compute)
+        struct DriveCoefficients {
+            float driveDb;
+            float gain;                                 // 10^(drive/20)
+            float atanNorm;                             // atan output normalisation
+            float tanhNorm;                             // tanh output normalisation
+        };
+        static DriveCoefficients computeDrive(float driveDb);
+
+        FastSaturator();
+        ~FastSaturator();
+
+        void setDrive(float driveDb);                   // drive in dB, gains recomputed on change only
+        void setDrive(const DriveCoefficients& coefficients);
+        void setKernel(SaturatorKernel kernel) { mKernel_ = kernel; }
+        SaturatorKernel getKernel() const { return mKernel_; }
+
+        // Per-sample processing
+        float processAudioAtan(float inputSample) const;
+        float processAudioTanh(float inputSample) const;
+        // Block processing, kernel selected once per block ('input' and 'output' may be the same memory)
+        void processAudioAtan(const float* input, float* output, std::size_t size) const;
+        void processAudioTanh(const float* input, float* output, std::size_t size) const;
+
+        // Curves without drive and normalisation
+        static float atanExact(float x) { return std::atan(x); }
+        static float tanhExact(float x) { return std::tanh(x); }
+        static float atanRational(float x);
+        static float tanhRational(float x);
+        static float atanTable(float x);
+        static float tanhTable(float x);
+
+    private:
+        static constexpr float kTableScale = TableSize/kTableRange;     // table points per unit
+        static constexpr SaturatorTables<TableSize> kTables{kTableRange};
+
+        // Drive coefficients against the drive in dB (gain >= 1 over the table range)
+        static constexpr double driveGain(double driveDb) { return constexprMath::exp(driveDb*(constexprMath::log(10.0)/20.0)); }
+        static constexpr double atanNorm(double driveDb) { return 1.0/((0.9 + 0.1*driveGain(driveDb))*constexprMath::atan(driveGain(driveDb))); }
+        static constexpr double tanhNorm(double driveDb) { return 1.0/((0.7 + 0.3*driveGain(driveDb))*constexprMath::tanh(driveGain(driveDb))); }
+        static constexpr ControlTable<256> kDriveGainTable{driveGain, 0.0, kDriveTableRange};
+        static constexpr ControlTable<256> kAtanNormTable{atanNorm, 0.0, kDriveTableRange};
+        static constexpr ControlTable<256> kTanhNormTable{tanhNorm, 0.0, kDriveTableRange};
+
+        // Curve loop of a block, one instantiation per kernel
+        template<float (*Curve)(float)>
+        static void processBlockPrivate(const float* input, float* output, std::size_t size, float gain, float norm);
+
+        SaturatorKernel mKernel_;
+        float mDriveDb_;                                // last drive set
+        float mDriveGain_;                              // 10^(drive/20)
+        float mAtanNorm_;                               // atan output normalisation
+        float mTanhNorm_;                               // tanh output normalisation
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "FastSaturator.tpp"
+
+#endif /* FastSaturator_hpp */
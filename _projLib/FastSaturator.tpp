@@ -0,0 +1,223 @@
+/** -------------------------------------------------------------------------
+    FastSaturator.tpp - Implementation file for FastSaturator class.
+    Atan/tanh saturation curves of the ReverbZ tank, with fast kernels.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "FastSaturator.hpp"
+#include <cmath>
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t TableSize> constexpr float FastSaturator<TableSize>::kTableRange;
+template<std::size_t TableSize> constexpr float FastSaturator<TableSize>::kTanhClamp;
+template<std::size_t TableSize> constexpr float FastSaturator<TableSize>::kTableScale;
+template<std::size_t TableSize> constexpr SaturatorTables<TableSize> FastSaturator<TableSize>::kTables;
+template<std::size_t TableSize> constexpr float FastSaturator<TableSize>::kDriveTableRange;
+template<std::size_t TableSize> constexpr ControlTable<256> FastSaturator<TableSize>::kDriveGainTable;
+template<std::size_t TableSize> constexpr ControlTable<256> FastSaturator<TableSize>::kAtanNormTable;
+template<std::size_t TableSize> constexpr ControlTable<256> FastSaturator<TableSize>::kTanhNormTable;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t TableSize>
+FastSaturator<TableSize>::FastSaturator()
+:
+mKernel_(SaturatorKernel::Rational),
+mDriveDb_(-1.0f),
+mDriveGain_(1.0f),
+mAtanNorm_(1.0f),
+mTanhNorm_(1.0f)
+{
+    setDrive(0.0f);
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t TableSize>
+FastSaturator<TableSize>::~FastSaturator(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t TableSize>
+void FastSaturator<TableSize>::setDrive(float driveDb)
+{
+    // Controls are set every block: the pow and the curve normalisations only run on change
+    if (driveDb == mDriveDb_) return;
+    setDrive(computeDrive(driveDb));
+}
+
+template<std::size_t TableSize>
+void FastSaturator<TableSize>::setDrive(const DriveCoefficients& coefficients)
+{
+    mDriveDb_ = coefficients.driveDb;
+    mDriveGain_ = coefficients.gain;
+    mAtanNorm_ = coefficients.atanNorm;
+    mTanhNorm_ = coefficients.tanhNorm;
+}
+
+template<std::size_t TableSize>
+typename FastSaturator<TableSize>::DriveCoefficients FastSaturator<TableSize>::computeDrive(float driveDb)
+{
+    DriveCoefficients coefficients;
+    coefficients.driveDb = driveDb;
+    if (driveDb >= 0.0f && driveDb <= kDriveTableRange)
+    {
+        // Panel range: no libm call
+        coefficients.gain = kDriveGainTable.lookup(driveDb);
+        coefficients.atanNorm = kAtanNormTable.lookup(driveDb);
+        coefficients.tanhNorm = kTanhNormTable.lookup(driveDb);
+        return coefficients;
+    }
+    coefficients.gain = std::pow(10.0f, driveDb/20.0f);
+    const float gain = coefficients.gain;
+    if (gain < 1.0f)
+    {
+        coefficients.atanNorm = 1.0f/std::atan(gain);
+        coefficients.tanhNorm = 1.0f/std::tanh(gain);
+    }
+    else
+    {
+        // normalise to avoid volume increase - empirical derivation
+        coefficients.atanNorm = 1.0f/((0.9f + 0.1f*gain)*std::atan(gain));
+        coefficients.tanhNorm = 1.0f/((0.7f + 0.3f*gain)*std::tanh(gain));
+    }
+    return coefficients;
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::processAudioAtan(float inputSample) const
+{
+    const float x = inputSample*mDriveGain_;
+    switch (mKernel_)
+    {
+        case SaturatorKernel::Exact:    return std::atan(x)*mAtanNorm_;
+        case SaturatorKernel::Rational: return atanRational(x)*mAtanNorm_;
+        case SaturatorKernel::Table:    return atanTable(x)*mAtanNorm_;
+    }
+    return 0.0f;
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::processAudioTanh(float inputSample) const
+{
+    const float x = inputSample*mDriveGain_;
+    switch (mKernel_)
+    {
+        case SaturatorKernel::Exact:    return std::tanh(x)*mTanhNorm_;
+        case SaturatorKernel::Rational: return tanhRational(x)*mTanhNorm_;
+        case SaturatorKernel::Table:    return tanhTable(x)*mTanhNorm_;
+    }
+    return 0.0f;
+}
+
+template<std::size_t TableSize>
+void FastSaturator<TableSize>::processAudioAtan(const float* input, float* output, std::size_t size) const
+{
+    switch (mKernel_)
+    {
+        case SaturatorKernel::Exact:    processBlockPrivate<atanExact>(input, output, size, mDriveGain_, mAtanNorm_);    break;
+        case SaturatorKernel::Rational: processBlockPrivate<atanRational>(input, output, size, mDriveGain_, mAtanNorm_); break;
+        case SaturatorKernel::Table:    processBlockPrivate<atanTable>(input, output, size, mDriveGain_, mAtanNorm_);    break;
+    }
+}
+
+template<std::size_t TableSize>
+void FastSaturator<TableSize>::processAudioTanh(const float* input, float* output, std::size_t size) const
+{
+    switch (mKernel_)
+    {
+        case SaturatorKernel::Exact:    processBlockPrivate<tanhExact>(input, output, size, mDriveGain_, mTanhNorm_);    break;
+        case SaturatorKernel::Rational: processBlockPrivate<tanhRational>(input, output, size, mDriveGain_, mTanhNorm_); break;
+        case SaturatorKernel::Table:    processBlockPrivate<tanhTable>(input, output, size, mDriveGain_, mTanhNorm_);    break;
+    }
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::atanRational(float x)
+{
+    // |x| > 1: atan(x) = +/-pi/2 - atan(1/x)
+    const float absX = std::fabs(x);
+    const bool inverted = absX > 1.0f;
+    const float t = inverted ? 1.0f/absX : absX;
+
+    // Odd minimax polynomial on [0, 1] (Abramowitz & Stegun 4.4.49)
+    const float t2 = t*t;
+    float p = 0.0028662257f;
+    p = p*t2 - 0.0161657367f;
+    p = p*t2 + 0.0429096138f;
+    p = p*t2 - 0.0752896400f;
+    p = p*t2 + 0.1065626393f;
+    p = p*t2 - 0.1420889944f;
+    p = p*t2 + 0.1999355085f;
+    p = p*t2 - 0.3333314528f;
+    float y = t + t*t2*p;
+
+    if (inverted) y = 1.57079632679f - y;
+    return (x < 0.0f) ? -y : y;
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::tanhRational(float x)
+{
+    // Lambert's continued fraction truncated to a 7/6 rational
+    if (x > kTanhClamp) return 1.0f;
+    if (x < -kTanhClamp) return -1.0f;
+    const float x2 = x*x;
+    const float numerator = x*(135135.0f + x2*(17325.0f + x2*(378.0f + x2)));
+    const float denominator = 135135.0f + x2*(62370.0f + x2*(3150.0f + x2*28.0f));
+    return numerator/denominator;
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::atanTable(float x)
+{
+    const float absX = std::fabs(x);
+    float y;
+    if (absX < kTableRange)
+    {
+        const float position = absX*kTableScale;
+        const std::size_t index = static_cast<std::size_t>(position);
+        const float fraction = position - static_cast<float>(index);
+        y = kTables.atanCurve[index] + fraction*(kTables.atanCurve[index + 1] - kTables.atanCurve[index]);
+    }
+    else
+    {
+        // Past the table: asymptotic series
+        const float inverse = 1.0f/absX;
+        y = 1.57079632679f - inverse + inverse*inverse*inverse*(1.0f/3.0f);
+    }
+    return (x < 0.0f) ? -y : y;
+}
+
+template<std::size_t TableSize>
+float FastSaturator<TableSize>::tanhTable(float x)
+{
+    const float absX = std::fabs(x);
+    float y = 1.0f;
+    if (absX < kTableRange)
+    {
+        const float position = absX*kTableScale;
+        const std::size_t index = static_cast<std::size_t>(position);
+        const float fraction = position - static_cast<float>(index);
+        y = kTables.tanhCurve[index] + fraction*(kTables.tanhCurve[index + 1] - kTables.tanhCurve[index]);
+    }
+    return (x < 0.0f) ? -y : y;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t TableSize>
+template<float (*Curve)(float)>
+void FastSaturator<TableSize>::processBlockPrivate(const float* input, float* output, std::size_t size, float gain, float norm)
+{
+    for (std::size_t i = 0; i < size; i++) output[i] = Curve(input[i]*gain)*norm;
+}
+
+}   // namespace projLib
@@ -0,0 +1,107 @@
+/** -------------------------------------------------------------------------
+    FractionalInterpolation.hpp - Fractional delay read policies.
+    LinearInterpolation, HermiteInterpolation and AllpassInterpolation.
+
+    A policy reads a ring buffer (read(delay) = sample written 'delay'
+    writes ago) at a fractional delay. It is a member of the modulated line,
+    since the allpass kernel keeps one sample of state per read tap.
+
+    - LinearInterpolation: 2 taps. Cheapest, but a lowpass that moves
+      with the fraction: dulls the tail and modulates its brightness.
+    - HermiteInterpolation: 4 taps, cubic Hermite (Catmull-Rom). Much less
+      dulling than linear for twice the taps.
+    - AllpassInterpolation: 2 taps, first-order Thiran allpass. Flat
+      magnitude at any fraction (no dulling), one divide per read. The
+      fraction is kept in [0.5, 1.5) so the pole stays away from z = -1.
+      Fine for slowly moving delays (LFO modulation), not for jumps.
+
+    tools/interpolationBenchmark measures the three on the host: magnitude
+    of a read at the fraction 0.5, and cost of one LFO-modulated line
+    including its ModulationEngine share.
+
+    Each policy gives the delay range it can read: [kMinDelay, buffer
+    size - 1 - kTapsAfter], kTapsAfter being the taps older than floor(delay).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef FractionalInterpolation_hpp
+#define FractionalInterpolation_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+/* --------------------------- LinearInterpolation -------------------------- */
+struct LinearInterpolation {
+    static constexpr float kMinDelay = 1.0f;
+    static constexpr std::size_t kTapsAfter = 1;
+
+    void reset() {}
+
+    template<typename RingBuffer>
+    float read(const RingBuffer& ringBuffer, float delaySamples)
+    {
+        return ringBuffer.readFractional(delaySamples);
+    }
+};
+
+/* -------------------------- HermiteInterpolation -------------------------- */
+struct HermiteInterpolation {
+    static constexpr float kMinDelay = 2.0f;            // newest tap at floor(delay) - 1 must be written already
+    static constexpr std::size_t kTapsAfter = 2;
+
+    void reset() {}
+
+    template<typename RingBuffer>
+    float read(const RingBuffer& ringBuffer, float delaySamples)
+    {
+        const std::size_t delayInteger = static_cast<std::size_t>(delaySamples);
+        const float t = delaySamples - static_cast<float>(delayInteger);
+        const float newer = ringBuffer.read(delayInteger - 1);
+        const float sample0 = ringBuffer.read(delayInteger);
+        const float sample1 = ringBuffer.read(delayInteger + 1);
+        const float older = ringBuffer.read(delayInteger + 2);
+
+        // Catmull-Rom between sample0 (t = 0) and sample1 (t = 1)
+        const float c1 = 0.5f*(sample1 - newer);
+        const float c2 = newer - 2.5f*sample0 + 2.0f*sample1 - 0.5f*older;
+        const float c3 = 0.5f*(older - newer) + 1.5f*(sample0 - sample1);
+        return ((c3*t + c2)*t + c1)*t + sample0;
+    }
+};
+
+/* -------------------------- AllpassInterpolation -------------------------- */
+struct AllpassInterpolation {
+    static constexpr float kMinDelay = 1.5f;            // integer part >= 1 after the fraction offset
+    static constexpr std::size_t kTapsAfter = 1;
+
+    AllpassInterpolation() : mPreviousOutput_(0.0f) {}
+
+    void reset() { mPreviousOutput_ = 0.0f; }
+
+    template<typename RingBuffer>
+    float read(const RingBuffer& ringBuffer, float delaySamples)
+    {
+        // Fraction in [0.5, 1.5): coefficient in (-0.2, 1/3]
+        const std::size_t delayInteger = static_cast<std::size_t>(delaySamples - 0.5f);
+        const float fraction = delaySamples - static_cast<float>(delayInteger);
+        const float coefficient = (1.0f - fraction)/(1.0f + fraction);
+
+        // y[n] = a*x[n] + x[n-1] - a*y[n-1] on the tap at floor(delay - 0.5)
+        const float output = coefficient*(ringBuffer.read(delayInteger) - mPreviousOutput_) + ringBuffer.read(delayInteger + 1);
+        mPreviousOutput_ = output;
+        return output;
+    }
+
+    private:
+        float mPreviousOutput_;
+};
+
+}   // namespace projLib
+
+#endif /* FractionalInterpolation_hpp */
@@ -0,0 +1,176 @@
+/** -------------------------------------------------------------------------
+    HalfRateReverbZ.hpp - Header file for HalfRateReverbZ class.
+    ReverbZ with its network running at half the sampling frequency.
+
+    Dattorro's network was designed at 29761 Hz and, at the usual damping
+    settings, little above 12 kHz survives the tank. Here the whole network
+    (predelay, input filters and diffusers, tank) is a ReverbZ at
+    SampleRate/2, between polyphase halfband resamplers:
+
+        in L/R -> mono -> halfband 2x down -> ReverbZ at SampleRate/2 (wet only)
+               -> halfband 2x up (L, R) -> + dry (full rate, untouched) -> out
+
+    About half the CPU of the network and half its delay memory, for a wet
+    band limited to ~11 kHz at 48 kHz (steep halfbands: ~99 dB stopband,
+    transition 0.04 of the full rate, a few samples of group delay on the
+    wet path). The resamplers take back part of the CPU saving: measured
+    by tools/halfRateReport. The decimator is the lowpass of the band edge: an input
+    lowpass cutoff above kWetBandwidth leaves the network's own one open.
+    The other cutoffs (input highpass, HF and LF damping) are clamped to
+    kWetBandwidth, below the network's Nyquist frequency: HF damping spans
+    up to ~11 kHz here instead of 20 kHz, higher settings damp the same.
+
+    Same controls and units as ReverbZ, all forwarded to the network except
+    the dry/wet mix, ramped here at the full rate. Modulation depths are
+    halved on the way (kModDepth1/2 are in samples of the network rate), so
+    the excursion in ms does not change. Scheduled control events reach the
+    network with a 2-sample resolution, Mix events are sample accurate.
+
+    Choose it at compile time in place of ReverbZ (ReverbZpatch: HALF_RATE=1):
+    the delay memory is sized for the network rate.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef HalfRateReverbZ_hpp
+#define HalfRateReverbZ_hpp
+
+#include <cstddef>
+#include "ControlTables.hpp"
+#include "DenormalGuard.hpp"
+#include "EventQueue.hpp"
+#include "PolyphaseHalfband.hpp"
+#include "ReverbZ.hpp"
+#include "SmootherBank.hpp"
+#include "SnapshotExchange.hpp"
+#include "TrackedParameter.hpp"
+
+namespace projLib {
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage = DelayStorage::PerLine,
+         typename TankFormat = Float32Format, typename ModInterpolation = LinearInterpolation>
+class HalfRateReverbZ {
+    public:
+        static_assert(SampleRate % 2 == 0, "HalfRateReverbZ: sample rate must be even");
+
+        // The network, at half rate
+        using Network = ReverbZ<(MaxPredelaySamples + 1)/2, SampleRate/2, Storage, TankFormat, ModInterpolation>;
+        using ProcessMode = typename Network::ProcessMode;
+        using ControlParameter = typename Network::ControlParameter;
+        using ProfileStage = typename Network::ProfileStage;
+        using Profile = typename Network::Profile;
+        static constexpr std::size_t kNumControlParameters = Network::kNumControlParameters;
+        static constexpr std::size_t kControlEventCapacity = Network::kControlEventCapacity;
+        static constexpr std::size_t kNumProfileStages = Network::kNumProfileStages;
+
+        static constexpr float kWetBandwidth = 0.23f*SampleRate;   // halfband passband edge (Hz)
+        static constexpr std::size_t kNumDelayBuffers = Network::kNumDelayBuffers;
+        static constexpr std::size_t kDelayMemorySize = Network::kDelayMemorySize;
+        static constexpr std::size_t kArenaMemorySize = Network::kArenaMemorySize;
+        static constexpr std::size_t kMemoryBytes = Network::kMemoryBytes;
+
+        HalfRateReverbZ();
+        ~HalfRateReverbZ();
+
+        void init(float* delayMemory);                  // all lines packed in kDelayMemorySize floats
+        bool init(TieredArena& arena);                  // lines placed over the arena tiers (false if out of memory)
+
+        // Control setters: control thread (main loop) only, see ReverbZ
+        void setProcessMode(ProcessMode processMode) { mNetwork_.setProcessMode(processMode); }
+        void setSaturatorKernel(SaturatorKernel kernel) { mNetwork_.setSaturatorKernel(kernel); }
+        void setSaturatorOversampling(int factor) { mNetwork_.setSaturatorOversampling(factor); }
+        void setModulationDepth(float depth);               // [0, 1], same excursion in ms as ReverbZ
+        void setModulationRate(float rateHz) { mNetwork_.setModulationRate(rateHz); }
+        void setControlParameters(float predelayTime,
+                                  float inputLowpassFc,
+                                  float inputHighpassFc,
+                                  float inputDiffusion,
+                                  float decay,
+                                  float drive,
+                                  float hfDamping,
+                                  float lfDamping,
+                                  float mixPercentage,
+                                  int smooth);
+        void setControlThreshold(ControlParameter parameter, float absoluteThreshold, float relativeThreshold = 0.0f);
+        void setSleepThreshold(float thresholdDb) { mNetwork_.setSleepThreshold(thresholdDb); }
+
+        // Sample-accurate control change: audio thread only, see ReverbZ. Offsets count
+        // full-rate samples (rounded to the network sample they fall in).
+        bool scheduleControl(ControlParameter parameter, float value, std::size_t sampleOffset);
+
+        // Stage profile of the network (resamplers and dry mix not included)
+        bool getProfile(Profile& profile) { return mNetwork_.getProfile(profile); }
+        void resetProfile() { mNetwork_.resetProfile(); }
+
+        // Processing: audio thread only
+        void processBlock(const float* in, float* out, std::size_t size);
+        void processBlock(const float* inL, const float* inR, float* outL, float* outR, std::size_t size);
+
+    private:
+        // Dry/wet gains handed to the audio thread
+        struct MixGains {
+            float dryGain;
+            float wetGain;
+        };
+        // Scheduled Mix change (the other controls are queued in the network)
+        struct MixEvent {
+            std::size_t sampleOffset;
+            MixGains gains;
+        };
+
+        static constexpr std::size_t kChunkSize = 64;                      // full-rate samples per network call
+        static constexpr std::size_t kMaxNetworkSize = kChunkSize/2 + 1;    // with the pending input sample
+        static constexpr float kMixRampTime = 0.02f;                        // same ramps as ReverbZ
+        static constexpr std::size_t kDryGain = 0;                          // mSmoothers_ indices
+        static constexpr std::size_t kWetGain = 1;
+
+        void initPrivate();
+        static MixGains cookMix(float mixPercentage);
+        // The decimator is the input lowpass above the wet band
+        static float networkLowpassFc(float inputLowpassFc);
+        // Other cutoffs: clamped to the wet band (the network rate cannot go higher)
+        static float networkFc(float fc);
+        void adoptMix();
+        void applyDueMixEvents(std::size_t offset);
+
+        // Wet path of a chunk: 'mono' input in, full-rate wet outputs in mWetL_/mWetR_
+        void processWet(const float* mono, std::size_t size);
+
+        /* ------------------------- CONTROL THREAD SIDE ------------------------ */
+        TrackedParameter mMixControl_;
+        SnapshotExchange<MixGains> mMixExchange_;
+
+        /* -------------------------- AUDIO THREAD SIDE ------------------------- */
+        Network mNetwork_;
+        HalfbandDownsampler2x<kHalfbandSteepCoefs> mDecimator_;
+        HalfbandUpsampler2x<kHalfbandSteepCoefs> mInterpolatorL_;
+        HalfbandUpsampler2x<kHalfbandSteepCoefs> mInterpolatorR_;
+        SmootherBank<2> mSmoothers_;                        // dry and wet gains
+        EventQueue<MixEvent, kControlEventCapacity> mMixEvents_;
+        MixGains mMixGains_;                                // last adopted
+        bool mIsMixApplied_;                                // false: next mix is applied without a ramp
+
+        // Odd block sizes: one full-rate input sample waits for its pair, or one wet
+        // output sample waits for its slot (never both: the wet path is 1 sample late)
+        bool mIsInputPending_;
+        float mPendingInput_;
+        float mPendingWetL_, mPendingWetR_;
+
+        float mMono_[kChunkSize + 1];                       // pending sample + chunk
+        float mNetworkIn_[kMaxNetworkSize];
+        float mNetworkL_[kMaxNetworkSize];
+        float mNetworkR_[kMaxNetworkSize];
+        float mWetL_[2*kMaxNetworkSize + 1];                // pending sample + interpolated
+        float mWetR_[2*kMaxNetworkSize + 1];
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "HalfRateReverbZ.tpp"
+
+#endif /* HalfRateReverbZ_hpp */
@@ -0,0 +1,310 @@
+/** -------------------------------------------------------------------------
+    HalfRateReverbZ.tpp - Implementation file for HalfRateReverbZ class.
+    ReverbZ with its network running at half the sampling frequency.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "HalfRateReverbZ.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumControlParameters;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kControlEventCapacity;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumProfileStages;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kWetBandwidth;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumDelayBuffers;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kDelayMemorySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kArenaMemorySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kMemoryBytes;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kChunkSize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kMaxNetworkSize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kMixRampTime;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kDryGain;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kWetGain;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::HalfRateReverbZ()
+:
+mMixGains_(cookMix(100.0f)),            // ReverbZ default
+mIsMixApplied_(false),
+mIsInputPending_(false),
+mPendingInput_(0.0f),
+mPendingWetL_(0.0f),
+mPendingWetR_(0.0f)
+{
+    // The network only makes the wet signal, at ReverbZ's modulation excursion in ms
+    mNetwork_.setModulationDepth(0.5f);
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::~HalfRateReverbZ(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::init(float* delayMemory)
+{
+    mNetwork_.init(delayMemory);
+    initPrivate();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::init(TieredArena& arena)
+{
+    if (!mNetwork_.init(arena)) return false;
+    initPrivate();
+    return true;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setModulationDepth(float depth)
+{
+    if (depth < 0.0f) depth = 0.0f;
+    if (depth > 1.0f) depth = 1.0f;
+    mNetwork_.setModulationDepth(0.5f*depth);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setControlParameters(float predelayTime,
+                                    float inputLowpassFc,
+                                    float inputHighpassFc,
+                                    float inputDiffusion,
+                                    float decay,
+                                    float drive,
+                                    float hfDampingFc,
+                                    float lfDampingFc,
+                                    float mixPercentage,
+                                    int smooth)
+{
+    // The network is wet only: the mix stays here, handed over on change
+    if (mMixControl_.update(mixPercentage)) mMixExchange_.publish(cookMix(mixPercentage));
+    mNetwork_.setControlParameters(predelayTime, networkLowpassFc(inputLowpassFc), networkFc(inputHighpassFc), inputDiffusion,
+                                   decay, drive, networkFc(hfDampingFc), networkFc(lfDampingFc), 100.0f, smooth);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setControlThreshold(ControlParameter parameter, float absoluteThreshold, float relativeThreshold)
+{
+    if (parameter == ControlParameter::Mix) mMixControl_.setThreshold(absoluteThreshold, relativeThreshold);
+    else                                    mNetwork_.setControlThreshold(parameter, absoluteThreshold, relativeThreshold);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::scheduleControl(ControlParameter parameter, float value, std::size_t sampleOffset)
+{
+    if (parameter == ControlParameter::Mix)
+    {
+        MixEvent event;
+        event.sampleOffset = sampleOffset;
+        event.gains = cookMix(value);
+        return mMixEvents_.push(event);
+    }
+
+    // Network sample of the input pair the full-rate sample belongs to
+    if (parameter == ControlParameter::InputLowpassFc) value = networkLowpassFc(value);
+    if (parameter == ControlParameter::InputHighpassFc || parameter == ControlParameter::HfDamping ||
+        parameter == ControlParameter::LfDamping) value = networkFc(value);
+    const std::size_t networkOffset = (sampleOffset + (mIsInputPending_ ? 1 : 0))/2;
+    return mNetwork_.scheduleControl(parameter, value, networkOffset);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlock(const float* in, float* out, std::size_t size)
+{
+    /* ------------ Process a block of mono samples here ------------ */
+    DenormalGuard denormalGuard;
+    adoptMix();
+    std::size_t start = 0;
+    while (start < size)
+    {
+        // Chunks cut at the scheduled Mix changes and where the mix ramp ends
+        applyDueMixEvents(start);
+        std::size_t end = mMixEvents_.nextOffset(size);
+        if (end - start > kChunkSize) end = start + kChunkSize;
+        end = start + mSmoothers_.getRampEnd(end - start);
+        const std::size_t chunk = end - start;
+
+        for (std::size_t i = 0; i < chunk; i++) mMono_[i + 1] = in[start + i];
+        processWet(mMono_ + 1, chunk);
+
+        // Dry/Wet -> Stereo to mono (read the input first: in and out may be the same memory)
+        // (gains ramped through the chunk, constant once settled)
+        const bool isRamped = mSmoothers_.processBlock(chunk);
+        float dryGain = isRamped ? mSmoothers_.getBlockStart(kDryGain) : mSmoothers_.getValue(kDryGain);
+        float wetGain = isRamped ? mSmoothers_.getBlockStart(kWetGain) : mSmoothers_.getValue(kWetGain);
+        const float dryGainStep = isRamped ? mSmoothers_.getBlockStep(kDryGain) : 0.0f;
+        const float wetGainStep = isRamped ? mSmoothers_.getBlockStep(kWetGain) : 0.0f;
+        for (std::size_t i = 0; i < chunk; i++)
+        {
+            dryGain += dryGainStep;
+            wetGain += wetGainStep;
+            const float outWetMono = (mWetL_[i] + mWetR_[i])/2.0f;
+            out[start + i] = mMono_[i + 1]*dryGain + outWetMono*wetGain;
+        }
+        start = end;
+    }
+    mMixEvents_.advance(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlock(const float* inL, const float* inR, float* outL, float* outR, std::size_t size)
+{
+    /* ------------ Process a block of LR samples here ------------ */
+    DenormalGuard denormalGuard;
+    adoptMix();
+    std::size_t start = 0;
+    while (start < size)
+    {
+        // Chunks cut at the scheduled Mix changes and where the mix ramp ends
+        applyDueMixEvents(start);
+        std::size_t end = mMixEvents_.nextOffset(size);
+        if (end - start > kChunkSize) end = start + kChunkSize;
+        end = start + mSmoothers_.getRampEnd(end - start);
+        const std::size_t chunk = end - start;
+
+        // Stereo->Mono: the network is Mono->Stereo
+        for (std::size_t i = 0; i < chunk; i++) mMono_[i + 1] = (inL[start + i] + inR[start + i])/2.0f;
+        processWet(mMono_ + 1, chunk);
+
+        // Dry/Wet
+        // (gains ramped through the chunk, constant once settled)
+        const bool isRamped = mSmoothers_.processBlock(chunk);
+        float dryGain = isRamped ? mSmoothers_.getBlockStart(kDryGain) : mSmoothers_.getValue(kDryGain);
+        float wetGain = isRamped ? mSmoothers_.getBlockStart(kWetGain) : mSmoothers_.getValue(kWetGain);
+        const float dryGainStep = isRamped ? mSmoothers_.getBlockStep(kDryGain) : 0.0f;
+        const float wetGainStep = isRamped ? mSmoothers_.getBlockStep(kWetGain) : 0.0f;
+        for (std::size_t i = 0; i < chunk; i++)
+        {
+            dryGain += dryGainStep;
+            wetGain += wetGainStep;
+            const float inputSampleL = inL[start + i];
+            const float inputSampleR = inR[start + i];
+            outL[start + i] = inputSampleL*dryGain + mWetL_[i]*wetGain;
+            outR[start + i] = inputSampleR*dryGain + mWetR_[i]*wetGain;
+        }
+        start = end;
+    }
+    mMixEvents_.advance(size);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::initPrivate()
+{
+    mDecimator_.init(halfbandSteep());
+    mInterpolatorL_.init(halfbandSteep());
+    mInterpolatorR_.init(halfbandSteep());
+    mMixEvents_.clear();
+
+    // Last mix until the next one is adopted, that one without a ramp (as in ReverbZ)
+    mSmoothers_.init(static_cast<float>(SampleRate), kMixRampTime);
+    mSmoothers_.setValue(kDryGain, mMixGains_.dryGain);
+    mSmoothers_.setValue(kWetGain, mMixGains_.wetGain);
+    mIsMixApplied_ = false;
+
+    // Start with a wet sample waiting (silence): see processWet()
+    mIsInputPending_ = false;
+    mPendingInput_ = 0.0f;
+    mPendingWetL_ = 0.0f;
+    mPendingWetR_ = 0.0f;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+typename HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::MixGains HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::cookMix(float mixPercentage)
+{
+    // Equal-power law, as in ReverbZ
+    MixGains gains;
+    equalPowerGains(mixPercentage/100.0f, gains.dryGain, gains.wetGain);
+    return gains;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+float HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::networkLowpassFc(float inputLowpassFc)
+{
+    // Above the wet band the decimator does the filtering: the network's lowpass is
+    // opened all the way (and left out of its processing, see ReverbZ)
+    return (inputLowpassFc > kWetBandwidth) ? static_cast<float>(SampleRate) : inputLowpassFc;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+float HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::networkFc(float fc)
+{
+    return (fc > kWetBandwidth) ? kWetBandwidth : fc;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::adoptMix()
+{
+    if (!mMixExchange_.adopt(mMixGains_)) return;
+    if (!mIsMixApplied_)
+    {
+        mSmoothers_.setValue(kDryGain, mMixGains_.dryGain);
+        mSmoothers_.setValue(kWetGain, mMixGains_.wetGain);
+        mIsMixApplied_ = true;
+        return;
+    }
+    mSmoothers_.setTarget(kDryGain, mMixGains_.dryGain);
+    mSmoothers_.setTarget(kWetGain, mMixGains_.wetGain);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::applyDueMixEvents(std::size_t offset)
+{
+    while (mMixEvents_.isDue(offset))
+    {
+        const MixGains& gains = mMixEvents_.front().gains;
+        mSmoothers_.setTarget(kDryGain, gains.dryGain);
+        mSmoothers_.setTarget(kWetGain, gains.wetGain);
+        mMixEvents_.pop();
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void HalfRateReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processWet(const float* mono, std::size_t size)
+{
+    // Input pairs: the sample left pending by an odd chunk goes first ('mono' is
+    // mMono_ + 1, the slot in front of it is free)
+    const float* input = mono;
+    std::size_t inputSize = size;
+    const bool isOutputPending = !mIsInputPending_;
+    if (mIsInputPending_)
+    {
+        mMono_[0] = mPendingInput_;
+        input = mMono_;
+        inputSize++;
+    }
+    const std::size_t networkSize = inputSize/2;
+    mIsInputPending_ = (inputSize % 2) != 0;
+    if (mIsInputPending_) mPendingInput_ = input[inputSize - 1];
+
+    // Network at half rate, wet only (same buffer for both inputs: mono in)
+    mDecimator_.processBlock(input, mNetworkIn_, networkSize);
+    if (networkSize > 0) mNetwork_.processBlock(mNetworkIn_, mNetworkIn_, mNetworkL_, mNetworkR_, networkSize);
+
+    // Back to full rate behind the wet sample left over by the previous chunk. With one
+    // full-rate sample always pending on one side or the other, exactly 'size' wet samples
+    // are ready, plus one to keep when no input is left pending.
+    const std::size_t offset = isOutputPending ? 1 : 0;
+    mWetL_[0] = mPendingWetL_;
+    mWetR_[0] = mPendingWetR_;
+    mInterpolatorL_.processBlock(mNetworkL_, mWetL_ + offset, networkSize);
+    mInterpolatorR_.processBlock(mNetworkR_, mWetR_ + offset, networkSize);
+    if (!mIsInputPending_)
+    {
+        mPendingWetL_ = mWetL_[size];
+        mPendingWetR_ = mWetR_[size];
+    }
+}
+
+}   // namespace projLib
@@ -0,0 +1,107 @@
+/** -------------------------------------------------------------------------
+    HostCallbackTimer.hpp - Header file for HostCallbackTimer class.
+    Audio callback simulation on a host: a timer thread calls the callback
+    once per block period.
+
+    Stands in for the codec DMA interrupt when firmware code runs on a
+    desktop (host tools, LoadMonitor accounting): start() spawns a thread
+    that wakes up at every block period, on an absolute schedule (a late
+    callback does not shift the following ones), and runs the callback
+    there. A callback that takes longer than the period makes the next
+    ones start late, like an overrun on the hardware. stop() joins the
+    thread.
+
+    SteadyClock: std::chrono::steady_clock with the CycleCounter interface
+    (counts are nanoseconds, rate kRate), to run a LoadMonitor on the host.
+
+    Host-only implementation (std::thread, std::chrono).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef HostCallbackTimer_hpp
+#define HostCallbackTimer_hpp
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace projLib {
+
+struct SteadyClock {
+    using Count = std::uint64_t;
+    static constexpr float kRate = 1.0e9f;              // counts per second
+
+    static void enable() {}
+    static Count now()
+    {
+        return static_cast<Count>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    static Count elapsed(Count start, Count end) { return end - start; }
+};
+
+class HostCallbackTimer {
+    public:
+        HostCallbackTimer();
+        ~HostCallbackTimer();
+
+        HostCallbackTimer(const HostCallbackTimer&) = delete;
+        HostCallbackTimer& operator=(const HostCallbackTimer&) = delete;
+
+        // Call 'callback' (no arguments) every blockSize/sampleRate seconds until stop()
+        template<typename Callback>
+        void start(Callback callback, float sampleRate, std::size_t blockSize);
+        void stop();
+
+        bool isRunning() const { return mIsRunning_.load(std::memory_order_relaxed); }
+
+    private:
+        std::thread mThread_;
+        std::atomic<bool> mIsRunning_;
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline HostCallbackTimer::HostCallbackTimer()
+:
+mIsRunning_(false)
+{}
+
+inline HostCallbackTimer::~HostCallbackTimer()
+{
+    stop();
+}
+
+template<typename Callback>
+void HostCallbackTimer::start(Callback callback, float sampleRate, std::size_t blockSize)
+{
+    stop();
+    const std::chrono::nanoseconds period(static_cast<std::int64_t>(1.0e9*static_cast<double>(blockSize)/static_cast<double>(sampleRate)));
+    mIsRunning_.store(true, std::memory_order_relaxed);
+    mThread_ = std::thread([this, callback, period]() mutable
+    {
+        std::chrono::steady_clock::time_point wakeUp = std::chrono::steady_clock::now();
+        while (mIsRunning_.load(std::memory_order_relaxed))
+        {
+            wakeUp += period;
+            std::this_thread::sleep_until(wakeUp);
+            callback();
+        }
+    });
+}
+
+inline void HostCallbackTimer::stop()
+{
+    mIsRunning_.store(false, std::memory_order_relaxed);
+    if (mThread_.joinable()) mThread_.join();
+}
+
+}   // namespace projLib
+
+#endif /* HostCallbackTimer_hpp */
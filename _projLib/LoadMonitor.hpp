@@ -0,0 +1,98 @@
+/** -------------------------------------------------------------------------
+    LoadMonitor.hpp - Header file for LoadMonitor class.
+    Audio callback deadline monitor and load telemetry.
+
+    The callback brackets its work with beginCallback() / endCallback().
+    Its deadline (budget) is one block period, in clock counts:
+
+        budget = clockRate*blockSize/sampleRate
+
+    e.g. 480 MHz*4/48 kHz = 40000 cycles (83 us) on the Patch SM. Every
+    callback longer than its budget is an overrun (the DMA caught up with
+    the buffer: a glitch). Over a window of callbacks (windowTime) the busy
+    counts are summed; at the end of each window the telemetry is handed
+    over through a SnapshotExchange, for the main loop to read with
+    getTelemetry() while the audio keeps running:
+
+        load            busy fraction of the last window (1 = 100 %)
+        peakLoad        highest window load since the last reset
+        worstLoad       longest single callback, fraction of the budget
+                        (high-water mark since the last reset)
+        worstCounts     same, in clock counts
+        overruns        callbacks over budget since init()
+        callbacks       callbacks since init()
+
+    Clock: CycleCounter (default), or any class with the same now() /
+    elapsed() interface: on a host, the accounting is driven by a
+    HostCallbackTimer with a SteadyClock (HostCallbackTimer.hpp).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef LoadMonitor_hpp
+#define LoadMonitor_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "CycleCounter.hpp"
+#include "SnapshotExchange.hpp"
+
+namespace projLib {
+
+// Load figures of the audio callback, see LoadMonitor
+struct LoadTelemetry {
+    float load;
+    float peakLoad;
+    float worstLoad;
+    std::uint32_t worstCounts;
+    std::uint32_t overruns;
+    std::uint32_t callbacks;
+};
+
+template<typename Clock = CycleCounter>
+class LoadMonitor {
+    public:
+        using Count = typename Clock::Count;
+
+        LoadMonitor();
+        ~LoadMonitor();
+
+        // Clock rate in counts per second (e.g. the CPU clock with CycleCounter on Cortex-M),
+        // audio block period, and length of the load averaging window in seconds
+        void init(float clockRate, float sampleRate, std::size_t blockSize, float windowTime = 0.1f);
+
+        // Audio thread: around the whole callback
+        Count beginCallback() const { return Clock::now(); }
+        void endCallback(Count start);
+
+        // Reader thread (one): true if 'telemetry' holds a newer window than the last read
+        bool getTelemetry(LoadTelemetry& telemetry) { return mExchange_.adopt(telemetry); }
+        // Restart the peaks (peakLoad, worstLoad) at the next window
+        void resetPeaks() { mIsResetRequested_.store(true, std::memory_order_relaxed); }
+
+        std::uint32_t getBudget() const { return mBudget_; }
+
+    private:
+        std::uint32_t mBudget_;                     // clock counts per block period
+        std::uint32_t mWindowCallbacks_;            // callbacks per averaging window
+        float mInverseWindowBudget_;                // 1/(budget*window callbacks)
+        float mInverseBudget_;
+
+        std::uint64_t mWindowBusy_;                 // counts spent in the current window
+        std::uint32_t mWindowCount_;                // callbacks in the current window
+        LoadTelemetry mTelemetry_;
+        std::atomic<bool> mIsResetRequested_;
+        SnapshotExchange<LoadTelemetry> mExchange_;
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "LoadMonitor.tpp"
+
+#endif /* LoadMonitor_hpp */
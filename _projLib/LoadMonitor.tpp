@@ -0,0 +1,86 @@
+/** -------------------------------------------------------------------------
+    LoadMonitor.tpp - Implementation file for LoadMonitor class.
+    Audio callback deadline monitor and load telemetry.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "LoadMonitor.hpp"
+
+namespace projLib {
+
+/* ------------------------------- Constructor ------------------------------ */
+template<typename Clock>
+LoadMonitor<Clock>::LoadMonitor()
+:
+mBudget_(1),
+mWindowCallbacks_(1),
+mInverseWindowBudget_(1.0f),
+mInverseBudget_(1.0f),
+mWindowBusy_(0),
+mWindowCount_(0),
+mTelemetry_(),
+mIsResetRequested_(false)
+{}
+/* ------------------------------- Destructor ------------------------------- */
+template<typename Clock>
+LoadMonitor<Clock>::~LoadMonitor(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<typename Clock>
+void LoadMonitor<Clock>::init(float clockRate, float sampleRate, std::size_t blockSize, float windowTime)
+{
+    Clock::enable();
+
+    const float blockPeriod = static_cast<float>(blockSize)/sampleRate;
+    mBudget_ = static_cast<std::uint32_t>(clockRate*blockPeriod);
+    if (mBudget_ < 1) mBudget_ = 1;
+    mWindowCallbacks_ = static_cast<std::uint32_t>(windowTime/blockPeriod);
+    if (mWindowCallbacks_ < 1) mWindowCallbacks_ = 1;
+    mInverseBudget_ = 1.0f/static_cast<float>(mBudget_);
+    mInverseWindowBudget_ = mInverseBudget_/static_cast<float>(mWindowCallbacks_);
+
+    mWindowBusy_ = 0;
+    mWindowCount_ = 0;
+    mTelemetry_ = LoadTelemetry();
+    mIsResetRequested_.store(false, std::memory_order_relaxed);
+}
+
+template<typename Clock>
+void LoadMonitor<Clock>::endCallback(Count start)
+{
+    const std::uint64_t elapsed = Clock::elapsed(start, Clock::now());
+    const std::uint32_t duration = (elapsed > 0xFFFFFFFFu) ? 0xFFFFFFFFu : static_cast<std::uint32_t>(elapsed);
+
+    // Per callback: a compare or two, the rest once per window
+    LoadTelemetry& telemetry = mTelemetry_;
+    telemetry.callbacks++;
+    if (duration > mBudget_) telemetry.overruns++;
+    if (duration > telemetry.worstCounts) telemetry.worstCounts = duration;
+    mWindowBusy_ += duration;
+    if (++mWindowCount_ < mWindowCallbacks_) return;
+
+    telemetry.load = static_cast<float>(mWindowBusy_)*mInverseWindowBudget_;
+    if (telemetry.load > telemetry.peakLoad) telemetry.peakLoad = telemetry.load;
+    telemetry.worstLoad = static_cast<float>(telemetry.worstCounts)*mInverseBudget_;
+    mExchange_.publish(telemetry);
+    mWindowBusy_ = 0;
+    mWindowCount_ = 0;
+
+    // Peaks restart with the next window (the published ones cover the last)
+    if (mIsResetRequested_.exchange(false, std::memory_order_relaxed))
+    {
+        telemetry.peakLoad = 0.0f;
+        telemetry.worstLoad = 0.0f;
+        telemetry.worstCounts = 0;
+    }
+}
+
+}   // namespace projLib
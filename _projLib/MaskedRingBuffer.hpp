@@ -0,0 +1,74 @@
+/** -------------------------------------------------------------------------
+    MaskedRingBuffer.hpp - Header file for MaskedRingBuffer class.
+    Power-of-two circular buffer on external storage, wrapped with a mask.
+
+    Drop-in RingBuffer for BlockAllPass and BlockDelayLine (same interface as
+    BlockRingBuffer). The capacity is MinSamples rounded up to a power of two
+    at compile time (kSize), so every index wrap is a single AND instead of a
+    compare and subtract. Fractional reads for modulated delays use the same
+    mask on both interpolation taps.
+
+    The buffer is not owned: kSize samples are bound in init(), stored in
+    the Format parameter's type (see SampleFormat.hpp).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef MaskedRingBuffer_hpp
+#define MaskedRingBuffer_hpp
+
+#include <cstddef>
+#include "SampleFormat.hpp"
+#include "SharedDelayMemory.hpp"
+
+namespace projLib {
+
+template<std::size_t MinSamples, typename Format = Float32Format>
+class MaskedRingBuffer {
+    public:
+        using SampleType = typename Format::Type;
+
+        static constexpr std::size_t kSize = nextPowerOfTwo(MinSamples);   // samples of storage
+        static constexpr std::size_t kMask = kSize - 1;
+
+        MaskedRingBuffer();
+        ~MaskedRingBuffer();
+
+        void init(SampleType* buffer);              // bind and clear kSize samples of storage
+
+        // Index of the sample written 'delaySamples' writes ago (0 = the next write position)
+        std::size_t getReadIndex(std::size_t delaySamples) const { return (mWriteIndex_ - delaySamples) & kMask; }
+        std::size_t getWriteIndex() const { return mWriteIndex_; }
+        // Samples from 'index' to the end of the buffer
+        std::size_t getContiguousSamples(std::size_t index) const { return kSize - index; }
+        std::size_t wrapIndex(std::size_t index) const { return index & kMask; }
+        SampleType* getData() const { return mBuffer_; }
+
+        // Per-sample access
+        float read(std::size_t delaySamples) const { return Format::decode(mBuffer_[getReadIndex(delaySamples)]); }
+        // Linear interpolation between read(floor(delay)) and read(floor(delay) + 1)
+        float readFractional(float delaySamples) const;
+        void write(float inputSample);
+
+        // Block access. readBlock() does not advance, writeBlock() and advance() do.
+        void readBlock(std::size_t delaySamples, float* output, std::size_t size) const;
+        void writeBlock(const float* input, std::size_t size);
+        // Zero the 'size' samples readBlock() would return for the same arguments
+        void clearBlock(std::size_t delaySamples, std::size_t size);
+        void advance(std::size_t size) { mWriteIndex_ = (mWriteIndex_ + size) & kMask; }
+
+    private:
+        SampleType* mBuffer_;                       // external storage, kSize long
+        std::size_t mWriteIndex_;                   // next write position
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "MaskedRingBuffer.tpp"
+
+#endif /* MaskedRingBuffer_hpp */
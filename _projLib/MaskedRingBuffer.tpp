@@ -0,0 +1,111 @@
+/** -------------------------------------------------------------------------
+    MaskedRingBuffer.tpp - Implementation file for MaskedRingBuffer class.
+    Power-of-two circular buffer on external storage, wrapped with a mask.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "MaskedRingBuffer.hpp"
+#include <cstring>
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MinSamples, typename Format> constexpr std::size_t MaskedRingBuffer<MinSamples, Format>::kSize;
+template<std::size_t MinSamples, typename Format> constexpr std::size_t MaskedRingBuffer<MinSamples, Format>::kMask;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MinSamples, typename Format>
+MaskedRingBuffer<MinSamples, Format>::MaskedRingBuffer()
+:
+mBuffer_(nullptr),
+mWriteIndex_(0)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MinSamples, typename Format>
+MaskedRingBuffer<MinSamples, Format>::~MaskedRingBuffer(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MinSamples, typename Format>
+void MaskedRingBuffer<MinSamples, Format>::init(SampleType* buffer)
+{
+    // Bind external storage and clear it (SDRAM is not zeroed at startup)
+    mBuffer_ = buffer;
+    memset(mBuffer_, 0, kSize*sizeof(SampleType));
+    mWriteIndex_ = 0;
+}
+
+template<std::size_t MinSamples, typename Format>
+float MaskedRingBuffer<MinSamples, Format>::readFractional(float delaySamples) const
+{
+    const std::size_t delayInteger = static_cast<std::size_t>(delaySamples);
+    const float delayFraction = delaySamples - static_cast<float>(delayInteger);
+    const float sample0 = Format::decode(mBuffer_[(mWriteIndex_ - delayInteger) & kMask]);
+    const float sample1 = Format::decode(mBuffer_[(mWriteIndex_ - delayInteger - 1) & kMask]);
+    return sample0 + delayFraction*(sample1 - sample0);
+}
+
+template<std::size_t MinSamples, typename Format>
+void MaskedRingBuffer<MinSamples, Format>::write(float inputSample)
+{
+    // Write and wrap write position
+    mBuffer_[mWriteIndex_] = Format::encode(inputSample);
+    mWriteIndex_ = (mWriteIndex_ + 1) & kMask;
+}
+
+template<std::size_t MinSamples, typename Format>
+void MaskedRingBuffer<MinSamples, Format>::readBlock(std::size_t delaySamples, float* output, std::size_t size) const
+{
+    std::size_t readIndex = getReadIndex(delaySamples);
+    // Convert up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(readIndex);
+        if (segment > size) segment = size;
+        Format::decode(mBuffer_ + readIndex, output, segment);
+        output += segment;
+        size -= segment;
+        readIndex = 0;
+    }
+}
+
+template<std::size_t MinSamples, typename Format>
+void MaskedRingBuffer<MinSamples, Format>::writeBlock(const float* input, std::size_t size)
+{
+    // Convert up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(mWriteIndex_);
+        if (segment > size) segment = size;
+        Format::encode(input, mBuffer_ + mWriteIndex_, segment);
+        input += segment;
+        size -= segment;
+        advance(segment);
+    }
+}
+
+template<std::size_t MinSamples, typename Format>
+void MaskedRingBuffer<MinSamples, Format>::clearBlock(std::size_t delaySamples, std::size_t size)
+{
+    std::size_t index = getReadIndex(delaySamples);
+    // Clear up to two contiguous segments (before and after the buffer end)
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memset(mBuffer_ + index, 0, segment*sizeof(SampleType));
+        size -= segment;
+        index = 0;
+    }
+}
+
+}   // namespace projLib
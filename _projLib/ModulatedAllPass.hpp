@@ -0,0 +1,70 @@
+/** -------------------------------------------------------------------------
+    ModulatedAllPass.hpp - Header file for ModulatedAllPass class.
+    Schroeder allpass with a modulated fractional delay.
+
+    The delay is the base delay plus a modulation offset given with every
+    sample (e.g. a ModulationEngine output), read from a MaskedRingBuffer by
+    the Interpolation policy (see FractionalInterpolation.hpp). The
+    modulator is not owned, so any number of lines can share one set of
+    LFOs.
+
+    The buffer is not owned: kSize samples are bound in init(). MinSamples
+    must cover the base delay, the largest excursion and the policy's
+    kTapsAfter.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef ModulatedAllPass_hpp
+#define ModulatedAllPass_hpp
+
+#include <cstddef>
+#include "FractionalInterpolation.hpp"
+#include "MaskedRingBuffer.hpp"
+#include "SampleFormat.hpp"
+
+namespace projLib {
+
+template<std::size_t MinSamples, typename Interpolation = LinearInterpolation, typename Format = Float32Format>
+class ModulatedAllPass {
+    public:
+        using RingBuffer = MaskedRingBuffer<MinSamples, Format>;
+        static constexpr std::size_t kSize = RingBuffer::kSize;    // samples of storage
+
+        ModulatedAllPass();
+        ~ModulatedAllPass();
+
+        void init(typename RingBuffer::SampleType* buffer);    // bind and clear kSize samples of storage
+        void setDelaySamples(int delaySamples);                 // base delay, without modulation
+        int getDelaySamples() const;
+        void setFeedbackCoefficient(float feedbackCoefficient);
+
+        // Per-sample processing, delay = base delay + 'modulation' samples
+        float processAudio(float inputSample, float modulation);
+        // Block processing, one modulation offset per sample ('input' and 'output' may be the same memory)
+        void processAudio(const float* input, float* output, const float* modulation, std::size_t size);
+
+        // Zero 'size' samples of the buffer, starting 'offset' samples after the oldest
+        // one, and the interpolation state. Lets an idle allpass be cleared a bit at a time.
+        void clearHistory(std::size_t offset, std::size_t size);
+
+    private:
+        static constexpr float kMinDelay = Interpolation::kMinDelay;
+        static constexpr float kMaxDelay = static_cast<float>(kSize - 1 - Interpolation::kTapsAfter);
+
+        RingBuffer mRingBuffer_;                    // allpass state w[n]
+        Interpolation mInterpolation_;              // fractional read (and its state)
+        float mDelaySamples_;                       // base delay in samples [kMinDelay, kMaxDelay]
+        float mFeedbackCoefficient_;                // allpass gain g
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "ModulatedAllPass.tpp"
+
+#endif /* ModulatedAllPass_hpp */
@@ -0,0 +1,99 @@
+/** -------------------------------------------------------------------------
+    ModulatedAllPass.tpp - Implementation file for ModulatedAllPass class.
+    Schroeder allpass with a modulated fractional delay.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "ModulatedAllPass.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MinSamples, typename Interpolation, typename Format> constexpr std::size_t ModulatedAllPass<MinSamples, Interpolation, Format>::kSize;
+template<std::size_t MinSamples, typename Interpolation, typename Format> constexpr float ModulatedAllPass<MinSamples, Interpolation, Format>::kMinDelay;
+template<std::size_t MinSamples, typename Interpolation, typename Format> constexpr float ModulatedAllPass<MinSamples, Interpolation, Format>::kMaxDelay;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+ModulatedAllPass<MinSamples, Interpolation, Format>::ModulatedAllPass()
+:
+mRingBuffer_(),
+mInterpolation_(),
+mDelaySamples_(kMinDelay),
+mFeedbackCoefficient_(0.5f)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+ModulatedAllPass<MinSamples, Interpolation, Format>::~ModulatedAllPass(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+void ModulatedAllPass<MinSamples, Interpolation, Format>::init(typename RingBuffer::SampleType* buffer)
+{
+    mRingBuffer_.init(buffer);
+    mInterpolation_.reset();
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+void ModulatedAllPass<MinSamples, Interpolation, Format>::setDelaySamples(int delaySamples)
+{
+    // Clamp to the range the interpolation can read
+    float delay = static_cast<float>(delaySamples);
+    if (delay < kMinDelay) delay = kMinDelay;
+    if (delay > kMaxDelay) delay = kMaxDelay;
+    mDelaySamples_ = delay;
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+int ModulatedAllPass<MinSamples, Interpolation, Format>::getDelaySamples() const
+{
+    return static_cast<int>(mDelaySamples_);
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+void ModulatedAllPass<MinSamples, Interpolation, Format>::setFeedbackCoefficient(float feedbackCoefficient)
+{
+    mFeedbackCoefficient_ = feedbackCoefficient;
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+float ModulatedAllPass<MinSamples, Interpolation, Format>::processAudio(float inputSample, float modulation)
+{
+    float delay = mDelaySamples_ + modulation;
+    if (delay < kMinDelay) delay = kMinDelay;
+    if (delay > kMaxDelay) delay = kMaxDelay;
+
+    float delayOut = mInterpolation_.read(mRingBuffer_, delay);     // w[n-D(n)]
+    float delayIn = inputSample - delayOut*mFeedbackCoefficient_;   // w[n]
+    mRingBuffer_.write(delayIn);
+    return delayIn*mFeedbackCoefficient_ + delayOut;
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+void ModulatedAllPass<MinSamples, Interpolation, Format>::processAudio(const float* input, float* output, const float* modulation, std::size_t size)
+{
+    // The delay moves every sample: sample-serial, but the modulation is precomputed
+    for (std::size_t i = 0; i < size; i++) output[i] = processAudio(input[i], modulation[i]);
+}
+
+template<std::size_t MinSamples, typename Interpolation, typename Format>
+void ModulatedAllPass<MinSamples, Interpolation, Format>::clearHistory(std::size_t offset, std::size_t size)
+{
+    // The modulated read reaches anywhere in the buffer: clip to the whole of it
+    if (offset >= kSize) return;
+    if (size > kSize - offset) size = kSize - offset;
+    mRingBuffer_.clearBlock(kSize - offset, size);
+    mInterpolation_.reset();
+}
+
+}   // namespace projLib
@@ -0,0 +1,78 @@
+/** -------------------------------------------------------------------------
+    ModulationEngine.hpp - Header file for ModulationEngine class.
+    Shared control-rate quadrature LFOs for delay line modulation.
+
+    NumOscillators recursive quadrature oscillators (a rotating sin/cos
+    pair), advanced once every kControlPeriod samples by a precomputed
+    rotation: 4 multiplies per oscillator per control period, no phase
+    accumulator and no sine evaluation at run time. The amplitude is kept
+    on the unit circle by a first-order renormalisation at each update.
+
+    Inside a control period every output is linearly interpolated between
+    two updates, so per sample and per output the cost is one multiply-add
+    and the depth scaling. Both the sine and the cosine of each oscillator
+    are outputs (sineOutput(k), cosineOutput(k)): one oscillator drives two
+    lines in quadrature.
+
+    Per-sample and block processing produce the same values, whatever the
+    block sizes.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef ModulationEngine_hpp
+#define ModulationEngine_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+template<std::size_t NumOscillators>
+class ModulationEngine {
+    public:
+        static constexpr std::size_t kNumOutputs = 2*NumOscillators;
+        static constexpr std::size_t kControlPeriod = 32;           // samples between two oscillator updates
+
+        // Output index of the sine and cosine of an oscillator
+        static constexpr std::size_t sineOutput(std::size_t oscillator) { return 2*oscillator; }
+        static constexpr std::size_t cosineOutput(std::size_t oscillator) { return 2*oscillator + 1; }
+
+        ModulationEngine();
+        ~ModulationEngine();
+
+        void init(float sampleRate);                            // oscillators restart from phase 0
+        void setRate(std::size_t oscillator, float rateHz);     // rotation recomputed on change only
+        void setDepth(std::size_t output, float depth);         // output peak value (e.g. delay samples)
+        float getDepth(std::size_t output) const { return mDepth_[output]; }
+
+        // Next sample of every output: 'outputs' holds kNumOutputs values
+        void processSample(float* outputs);
+        // Next 'size' samples: outputs[k] holds 'size' samples of output k (nullptr: skipped)
+        void processBlock(float* const* outputs, std::size_t size);
+
+    private:
+        // Move the oscillators one control period ahead and set the output ramps
+        void updateOscillators();
+
+        float mSampleRate_;
+        float mRateHz_[NumOscillators];
+        float mRotationCos_[NumOscillators];            // phase increment of one control period
+        float mRotationSin_[NumOscillators];
+        float mSine_[NumOscillators];                   // oscillators at the end of the current period
+        float mCosine_[NumOscillators];
+        float mRampStart_[kNumOutputs];                 // unscaled outputs at the start of the period
+        float mRampStep_[kNumOutputs];                  // and their per-sample increment
+        float mDepth_[kNumOutputs];
+        std::size_t mPeriodPosition_;                   // samples into the period (kControlPeriod: update due)
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "ModulationEngine.tpp"
+
+#endif /* ModulationEngine_hpp */
@@ -0,0 +1,148 @@
+/** -------------------------------------------------------------------------
+    ModulationEngine.tpp - Implementation file for ModulationEngine class.
+    Shared control-rate quadrature LFOs for delay line modulation.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "ModulationEngine.hpp"
+#include <cmath>
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t NumOscillators> constexpr std::size_t ModulationEngine<NumOscillators>::kNumOutputs;
+template<std::size_t NumOscillators> constexpr std::size_t ModulationEngine<NumOscillators>::kControlPeriod;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t NumOscillators>
+ModulationEngine<NumOscillators>::ModulationEngine()
+:
+mSampleRate_(48000.0f),
+mPeriodPosition_(kControlPeriod)
+{
+    for (std::size_t k = 0; k < NumOscillators; k++) mRateHz_[k] = 0.0f;
+    for (std::size_t k = 0; k < kNumOutputs; k++) mDepth_[k] = 0.0f;
+    init(mSampleRate_);
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t NumOscillators>
+ModulationEngine<NumOscillators>::~ModulationEngine(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::init(float sampleRate)
+{
+    mSampleRate_ = sampleRate;
+    for (std::size_t k = 0; k < NumOscillators; k++)
+    {
+        // Phase 0: sine output starts from 0
+        mSine_[k] = 0.0f;
+        mCosine_[k] = 1.0f;
+        const float rateHz = mRateHz_[k];
+        mRateHz_[k] = -1.0f;                            // force the rotation update
+        setRate(k, rateHz);
+    }
+    for (std::size_t k = 0; k < kNumOutputs; k++)
+    {
+        mRampStart_[k] = 0.0f;
+        mRampStep_[k] = 0.0f;
+    }
+    mPeriodPosition_ = kControlPeriod;
+}
+
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::setRate(std::size_t oscillator, float rateHz)
+{
+    if (rateHz == mRateHz_[oscillator]) return;
+    mRateHz_[oscillator] = rateHz;
+
+    const float phaseIncrement = 6.28318530718f*rateHz*static_cast<float>(kControlPeriod)/mSampleRate_;
+    mRotationCos_[oscillator] = std::cos(phaseIncrement);
+    mRotationSin_[oscillator] = std::sin(phaseIncrement);
+}
+
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::setDepth(std::size_t output, float depth)
+{
+    mDepth_[output] = depth;
+}
+
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::processSample(float* outputs)
+{
+    if (mPeriodPosition_ == kControlPeriod) updateOscillators();
+
+    const float position = static_cast<float>(mPeriodPosition_);
+    for (std::size_t k = 0; k < kNumOutputs; k++)
+        outputs[k] = (mRampStart_[k] + position*mRampStep_[k])*mDepth_[k];
+    mPeriodPosition_++;
+}
+
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::processBlock(float* const* outputs, std::size_t size)
+{
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        if (mPeriodPosition_ == kControlPeriod) updateOscillators();
+
+        // Up to the end of the block or of the control period
+        std::size_t segment = kControlPeriod - mPeriodPosition_;
+        if (segment > size - offset) segment = size - offset;
+
+        for (std::size_t k = 0; k < kNumOutputs; k++)
+        {
+            if (outputs[k] == nullptr) continue;
+            float* output = outputs[k] + offset;
+            const float rampStart = mRampStart_[k];
+            const float rampStep = mRampStep_[k];
+            const float depth = mDepth_[k];
+            // Same expression as processSample(): identical values in both paths
+            for (std::size_t i = 0; i < segment; i++)
+                output[i] = (rampStart + static_cast<float>(mPeriodPosition_ + i)*rampStep)*depth;
+        }
+        mPeriodPosition_ += segment;
+        offset += segment;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t NumOscillators>
+void ModulationEngine<NumOscillators>::updateOscillators()
+{
+    const float stepScale = 1.0f/static_cast<float>(kControlPeriod);
+    for (std::size_t k = 0; k < NumOscillators; k++)
+    {
+        const float sine = mSine_[k];
+        const float cosine = mCosine_[k];
+
+        // Rotate by one control period, then pull the pair back on the unit circle
+        float nextSine = sine*mRotationCos_[k] + cosine*mRotationSin_[k];
+        float nextCosine = cosine*mRotationCos_[k] - sine*mRotationSin_[k];
+        const float gain = 1.5f - 0.5f*(nextSine*nextSine + nextCosine*nextCosine);
+        nextSine *= gain;
+        nextCosine *= gain;
+
+        // Ramps from the previous update to this one
+        mRampStart_[sineOutput(k)] = sine;
+        mRampStep_[sineOutput(k)] = (nextSine - sine)*stepScale;
+        mRampStart_[cosineOutput(k)] = cosine;
+        mRampStep_[cosineOutput(k)] = (nextCosine - cosine)*stepScale;
+
+        mSine_[k] = nextSine;
+        mCosine_[k] = nextCosine;
+    }
+    mPeriodPosition_ = 0;
+}
+
+}   // namespace projLib
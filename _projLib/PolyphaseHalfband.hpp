@@ -0,0 +1,103 @@
+/** -------------------------------------------------------------------------
+    PolyphaseHalfband.hpp - Header file for HalfbandUpsampler2x and
+    HalfbandDownsampler2x classes.
+    2x up/down sampling with polyphase IIR halfband filters.
+
+    The halfband lowpass is the sum of two allpass chains in z^-2 (elliptic
+    design, as in Laurent de Soras' HIIR), each section being
+        y[n] = c*(x[n] - y[n-1]) + x[n-1]
+    at the low rate. One chain per polyphase branch: NumCoefs multiplies per
+    low-rate sample for the whole 2x conversion, whatever the direction.
+    The filters are minimum phase (no linear phase), which is fine inside a
+    feedback loop and costs a few samples of group delay.
+
+    Coefficient sets (even index: branch 0, odd index: branch 1), transition
+    relative to the high rate:
+        halfbandSteep()     8 coefs, transition 0.04, ~99 dB stopband
+        halfbandRelaxed()   4 coefs, transition 0.12, ~76 dB stopband
+    The relaxed set is meant for the second stage of a 4x cascade, where
+    the signal only spans the lower quarter of the band.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef PolyphaseHalfband_hpp
+#define PolyphaseHalfband_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+// Coefficient sets, see the file header
+constexpr std::size_t kHalfbandSteepCoefs = 8;
+constexpr std::size_t kHalfbandRelaxedCoefs = 4;
+inline const float* halfbandSteep()
+{
+    static const float kCoefs[kHalfbandSteepCoefs] = {
+        0.0406334609f, 0.1505051290f, 0.3007570560f, 0.4607745050f,
+        0.6095243149f, 0.7385038411f, 0.8492238104f, 0.9497427837f
+    };
+    return kCoefs;
+}
+inline const float* halfbandRelaxed()
+{
+    static const float kCoefs[kHalfbandRelaxedCoefs] = {
+        0.0707659490f, 0.2578530785f, 0.5131675747f, 0.8173173544f
+    };
+    return kCoefs;
+}
+
+// One input sample -> two output samples
+template<std::size_t NumCoefs>
+class HalfbandUpsampler2x {
+    public:
+        HalfbandUpsampler2x();
+        ~HalfbandUpsampler2x();
+
+        void init(const float* coefs);              // NumCoefs coefficients, states cleared
+        void clear();
+
+        void processSample(float inputSample, float& output0, float& output1);
+        // 'output' holds 2*size samples
+        void processBlock(const float* input, float* output, std::size_t size);
+
+    private:
+        static_assert(NumCoefs % 2 == 0, "HalfbandUpsampler2x: one coefficient per branch and section");
+
+        float mCoefs_[NumCoefs];
+        float mX_[NumCoefs];                        // section inputs one low-rate sample ago
+        float mY_[NumCoefs];                        // section outputs one low-rate sample ago
+};
+
+// Two input samples -> one output sample
+template<std::size_t NumCoefs>
+class HalfbandDownsampler2x {
+    public:
+        HalfbandDownsampler2x();
+        ~HalfbandDownsampler2x();
+
+        void init(const float* coefs);              // NumCoefs coefficients, states cleared
+        void clear();
+
+        float processSample(float input0, float input1);
+        // 'input' holds 2*size samples
+        void processBlock(const float* input, float* output, std::size_t size);
+
+    private:
+        static_assert(NumCoefs % 2 == 0, "HalfbandDownsampler2x: one coefficient per branch and section");
+
+        float mCoefs_[NumCoefs];
+        float mX_[NumCoefs];
+        float mY_[NumCoefs];
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "PolyphaseHalfband.tpp"
+
+#endif /* PolyphaseHalfband_hpp */
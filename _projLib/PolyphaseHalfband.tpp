@@ -0,0 +1,129 @@
+/** -------------------------------------------------------------------------
+    PolyphaseHalfband.tpp - Implementation file for HalfbandUpsampler2x and
+    HalfbandDownsampler2x classes.
+    2x up/down sampling with polyphase IIR halfband filters.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#include "PolyphaseHalfband.hpp"
+
+namespace projLib {
+
+/* -------------------------------------------------------------------------- */
+/*                             HalfbandUpsampler2x                            */
+/* -------------------------------------------------------------------------- */
+template<std::size_t NumCoefs>
+HalfbandUpsampler2x<NumCoefs>::HalfbandUpsampler2x()
+{
+    for (std::size_t i = 0; i < NumCoefs; i++) mCoefs_[i] = 0.0f;
+    clear();
+}
+
+template<std::size_t NumCoefs>
+HalfbandUpsampler2x<NumCoefs>::~HalfbandUpsampler2x(){}
+
+template<std::size_t NumCoefs>
+void HalfbandUpsampler2x<NumCoefs>::init(const float* coefs)
+{
+    for (std::size_t i = 0; i < NumCoefs; i++) mCoefs_[i] = coefs[i];
+    clear();
+}
+
+template<std::size_t NumCoefs>
+void HalfbandUpsampler2x<NumCoefs>::clear()
+{
+    for (std::size_t i = 0; i < NumCoefs; i++)
+    {
+        mX_[i] = 0.0f;
+        mY_[i] = 0.0f;
+    }
+}
+
+template<std::size_t NumCoefs>
+void HalfbandUpsampler2x<NumCoefs>::processSample(float inputSample, float& output0, float& output1)
+{
+    // Both branches see the input: each one yields one of the two high-rate phases
+    float branch0 = inputSample;
+    float branch1 = inputSample;
+    for (std::size_t i = 0; i < NumCoefs; i += 2)
+    {
+        const float stageInput0 = branch0;
+        const float stageInput1 = branch1;
+        branch0 = (stageInput0 - mY_[i])*mCoefs_[i] + mX_[i];
+        branch1 = (stageInput1 - mY_[i + 1])*mCoefs_[i + 1] + mX_[i + 1];
+        mX_[i] = stageInput0;
+        mX_[i + 1] = stageInput1;
+        mY_[i] = branch0;
+        mY_[i + 1] = branch1;
+    }
+    output0 = branch0;
+    output1 = branch1;
+}
+
+template<std::size_t NumCoefs>
+void HalfbandUpsampler2x<NumCoefs>::processBlock(const float* input, float* output, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++) processSample(input[i], output[2*i], output[2*i + 1]);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                            HalfbandDownsampler2x                           */
+/* -------------------------------------------------------------------------- */
+template<std::size_t NumCoefs>
+HalfbandDownsampler2x<NumCoefs>::HalfbandDownsampler2x()
+{
+    for (std::size_t i = 0; i < NumCoefs; i++) mCoefs_[i] = 0.0f;
+    clear();
+}
+
+template<std::size_t NumCoefs>
+HalfbandDownsampler2x<NumCoefs>::~HalfbandDownsampler2x(){}
+
+template<std::size_t NumCoefs>
+void HalfbandDownsampler2x<NumCoefs>::init(const float* coefs)
+{
+    for (std::size_t i = 0; i < NumCoefs; i++) mCoefs_[i] = coefs[i];
+    clear();
+}
+
+template<std::size_t NumCoefs>
+void HalfbandDownsampler2x<NumCoefs>::clear()
+{
+    for (std::size_t i = 0; i < NumCoefs; i++)
+    {
+        mX_[i] = 0.0f;
+        mY_[i] = 0.0f;
+    }
+}
+
+template<std::size_t NumCoefs>
+float HalfbandDownsampler2x<NumCoefs>::processSample(float input0, float input1)
+{
+    // Branch 0 takes the odd phase, branch 1 the even one, then the halfband sum
+    float branch0 = input1;
+    float branch1 = input0;
+    for (std::size_t i = 0; i < NumCoefs; i += 2)
+    {
+        const float stageInput0 = branch0;
+        const float stageInput1 = branch1;
+        branch0 = (stageInput0 - mY_[i])*mCoefs_[i] + mX_[i];
+        branch1 = (stageInput1 - mY_[i + 1])*mCoefs_[i + 1] + mX_[i + 1];
+        mX_[i] = stageInput0;
+        mX_[i + 1] = stageInput1;
+        mY_[i] = branch0;
+        mY_[i + 1] = branch1;
+    }
+    return 0.5f*(branch0 + branch1);
+}
+
+template<std::size_t NumCoefs>
+void HalfbandDownsampler2x<NumCoefs>::processBlock(const float* input, float* output, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++) output[i] = processSample(input[2*i], input[2*i + 1]);
+}
+
+}   // namespace projLib
@@ -13,23 +13,160 @@
 #define ReverbZ_hpp
 
 // Include used dspLib components
-#include "../../dspLib/AllPass.hpp"
-#include "../../dspLib/DelayLine.hpp"  
-#include "../../dspLib/OnePoleFilter.hpp"
-#include "../../dspLib/Saturator.hpp"
 #include "../../dspLib/mathUtils.hpp"
+// Include projLib components
+#include "BlockAllPass.hpp"
+#include "BlockDelayLine.hpp"
+#include "ControlTables.hpp"
+#include "DenormalGuard.hpp"
+#include "EventQueue.hpp"
+#include "FastOnePole.hpp"
+#include "FastSaturator.hpp"
+#include "SaturatorOversampler.hpp"
+#include "ReverbZDelays.hpp"
+#include "MaskedRingBuffer.hpp"
+#include "ModulatedAllPass.hpp"
+#include "ModulationEngine.hpp"
+#include "SampleFormat.hpp"
+#include "SharedDelayMemory.hpp"
+#include "SmootherBank.hpp"
+#include "SnapshotExchange.hpp"
+#include "StageProfiler.hpp"
+#include "TieredArena.hpp"
+#include "TrackedParameter.hpp"
+#include <type_traits>
 
 namespace projLib {
 
-template<std::size_t MaxSamples>
+// Storage of the ReverbZ delay network
+enum class DelayStorage {
+    PerLine,        // every line owns a circular buffer and a write index
+    PerLineMasked,  // same, buffers rounded up to a power of two and wrapped with a mask
+    Shared          // every line is a region of one power-of-two circular buffer, one write index
+};
+
+// Buffer length of a fixed line for a given storage
+constexpr std::size_t delayLineSize(DelayStorage storage, std::size_t capacity)
+{
+    return (storage == DelayStorage::PerLineMasked) ? nextPowerOfTwo(capacity) : capacity;
+}
+
+// TankFormat: sample format of the tank delay lines and allpasses (see SampleFormat.hpp).
+// A 16-bit format halves their memory and bandwidth; per-line storage only.
+// ModInterpolation: fractional read of the modulated allpasses (see FractionalInterpolation.hpp).
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage = DelayStorage::PerLine,
+         typename TankFormat = Float32Format, typename ModInterpolation = LinearInterpolation>
 class ReverbZ {
     public:
-        ReverbZ(int sampleRate);
+        // Execution order of the processing graph inside a block
+        enum class ProcessMode {
+            SampleMajor,    // every sample runs through the whole graph
+            StageMajor      // every stage runs over a whole chunk of samples
+        };
+
+        // Continuous inputs of setControlParameters() (each with its own change detection)
+        // and of scheduleControl()
+        enum class ControlParameter {
+            PredelayTime,
+            InputLowpassFc,
+            InputHighpassFc,
+            InputDiffusion,
+            Decay,
+            Drive,
+            HfDamping,
+            LfDamping,
+            Mix
+        };
+        static constexpr std::size_t kNumControlParameters = 9;
+        static constexpr std::size_t kControlEventCapacity = 32;   // events scheduled ahead at most
+
+        // Stages timed by the profiler (PROJLIB_STAGE_PROFILING builds, see StageProfiler.hpp)
+        enum class ProfileStage {
+            InputFilters,       // predelay, input lowpass and highpass
+            InputDiffusers,     // input allpasses 1 - 4
+            ModulatedAllpasses, // tank inputs, LFOs and modulated allpasses
+            TankDelays,         // delay lines 1 - 4, allpasses 5/6 and decay
+            Saturators,         // curves and oversampling
+            Damping,            // tank lowpasses and highpasses
+            SmoothAllpasses,    // allpasses 7 - 10 (Smooth on or crossfading)
+            OutputMix           // output taps and dry/wet mix
+        };
+        static constexpr std::size_t kNumProfileStages = 8;
+        using Profiler = StageProfiler<ProfileStage, kNumProfileStages>;
+        using Profile = StageProfile<kNumProfileStages>;
+
+        // Dattorro's delay lengths scaled to SampleRate at compile time
+        using Delays = ReverbZDelays<SampleRate>;
+
+        // Chunk length of the stage-major scratch buffers: no longer than the tank delays
+        // 2/4, whose outputs are read before the chunk's inputs are computed. With shared
+        // storage no longer than any fixed line either (lines cannot advance on their own,
+        // so their per-sample fallback for blocks longer than the delay is not available).
+        static constexpr int kStageChunkLimit = (Storage == DelayStorage::Shared) ? Delays::kShortestFixedDelay : Delays::kShortestFeedbackDelay;
+        static constexpr std::size_t kStageBlockSize = (kStageChunkLimit < 64) ? kStageChunkLimit : 64;
+        static constexpr float kModDepth1 = 24.0f;      // max delay samples modulation of the smoothed tank
+        static constexpr float kModDepth2 = 48.0f;
+        static constexpr float kModRate1 = 0.6f;        // default LFO rates (Hz), the second one follows the first
+        static constexpr float kModRate2 = 0.8f;
+        static constexpr float kMaxModRate = 5.0f;
+        static constexpr float kDefaultSleepThresholdDb = -90.0f;  // silence sleep level (dBFS)
+
+        /* -------------------- Buffer capacity of each line -------------------- */
+        // Longest delay + 1, rounded up to 8 samples. Extra headroom where a block is
+        // written before it is read: one stage-major chunk on tank delays 1/3 (on every
+        // line with shared storage, where each region holds its own write-ahead), the
+        // modulation excursion (+ interpolation taps) on the modulated allpasses.
+        // With masked storage the fixed lines are then rounded up to a power of two,
+        // the modulated allpasses always are (they read through a MaskedRingBuffer).
+        static constexpr std::size_t kLineHeadroom = (Storage == DelayStorage::Shared) ? kStageBlockSize : 0;
+        static constexpr std::size_t kPredelaySize = delayLineCapacity(MaxPredelaySamples, 0);
+        static constexpr std::size_t kInputAllpass1Size = delayLineSize(Storage, delayLineCapacity(Delays::kInputAllpass1, kLineHeadroom));
+        static constexpr std::size_t kInputAllpass2Size = delayLineSize(Storage, delayLineCapacity(Delays::kInputAllpass2, kLineHeadroom));
+        static constexpr std::size_t kInputAllpass3Size = delayLineSize(Storage, delayLineCapacity(Delays::kInputAllpass3, kLineHeadroom));
+        static constexpr std::size_t kInputAllpass4Size = delayLineSize(Storage, delayLineCapacity(Delays::kInputAllpass4, kLineHeadroom));
+        static constexpr std::size_t kModAllpass1Size = nextPowerOfTwo(delayLineCapacity(Delays::kModAllpass1, static_cast<std::size_t>(kModDepth1) + ModInterpolation::kTapsAfter));
+        static constexpr std::size_t kModAllpass2Size = nextPowerOfTwo(delayLineCapacity(Delays::kModAllpass2, static_cast<std::size_t>(kModDepth2) + ModInterpolation::kTapsAfter));
+        static constexpr std::size_t kTankDelay1Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankDelay1, kStageBlockSize));
+        static constexpr std::size_t kTankDelay2Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankDelay2, kLineHeadroom));
+        static constexpr std::size_t kTankDelay3Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankDelay3, kStageBlockSize));
+        static constexpr std::size_t kTankDelay4Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankDelay4, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass5Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass5, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass6Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass6, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass7Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass7, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass8Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass8, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass9Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass9, kLineHeadroom));
+        static constexpr std::size_t kTankAllpass10Size = delayLineSize(Storage, delayLineCapacity(Delays::kTankAllpass10, kLineHeadroom));
+
+        // Floats of the 14 block-processed lines, packed back to back (sizes above are in
+        // samples: the tank lines take sampleStorageFloats<TankFormat>() of them)
+        static constexpr std::size_t kLineMemorySize =
+            kInputAllpass1Size + kInputAllpass2Size + kInputAllpass3Size + kInputAllpass4Size +
+            sampleStorageFloats<TankFormat>(kTankDelay1Size + kTankDelay2Size + kTankDelay3Size + kTankDelay4Size +
+                                            kTankAllpass5Size + kTankAllpass6Size + kTankAllpass7Size + kTankAllpass8Size +
+                                            kTankAllpass9Size + kTankAllpass10Size);
+        // Buffers bound to external delay memory by init(): one per line, or the shared one
+        static constexpr std::size_t kNumDelayBuffers = (Storage == DelayStorage::Shared) ? 1 : 14;
+        // Floats of external delay memory (e.g. SDRAM) required by init(float*)
+        static constexpr std::size_t kDelayMemorySize = (Storage == DelayStorage::Shared) ? nextPowerOfTwo(kLineMemorySize) : kLineMemorySize;
+        // Floats of one arena tier that holds every line for init(TieredArena&) (each buffer
+        // rounded up to the arena alignment, where kDelayMemorySize packs them tighter)
+        static constexpr std::size_t kArenaMemorySize = kDelayMemorySize + kNumDelayBuffers*TieredArena::kAlignment;
+        // Delay storage of one instance in bytes: external memory + predelay and modulated allpasses
+        static constexpr std::size_t kMemoryBytes = (kDelayMemorySize + kPredelaySize + kModAllpass1Size + kModAllpass2Size)*sizeof(float);
+
+        ReverbZ();
         ~ReverbZ();
 
-        void init();
-        void processAudioMono(float inputSample);
-        void processAudioStereo(float inputSampleL, float inputSampleR);
+        void init(float* delayMemory);                  // all lines packed in kDelayMemorySize floats
+        bool init(TieredArena& arena);                  // lines placed over the arena tiers (false if out of memory)
+
+        // Control setters: control thread (main loop) only. They cook every coefficient into
+        // a snapshot, handed over lock-free and adopted at the start of the next processed block.
+        void setProcessMode(ProcessMode processMode);
+        void setSaturatorKernel(SaturatorKernel kernel);    // tank saturation curves (Rational by default)
+        void setSaturatorOversampling(int factor);          // 1 (default), 2 or 4, off near 0 dB drive
+        void setModulationDepth(float depth);               // [0, 1] of kModDepth1/2 (1 by default)
+        void setModulationRate(float rateHz);               // LFO 1 rate [0, kMaxModRate], kModRate1 by default
         void setControlParameters(float predelayTime,
                                   float inputLowpassFc,
                                   float inputHighpassFc,
@@ -40,117 +177,346 @@ class ReverbZ {
                                   float lfDamping,
                                   float mixPercentage,
                                   int smooth);
+        // Dead band of a control input (units of the input): changes within it are ignored
+        void setControlThreshold(ControlParameter parameter, float absoluteThreshold, float relativeThreshold = 0.0f);
+        // Silence sleep: once the input peaks and the tank feedback stayed below this level
+        // for a whole trip through the network (predelay, diffusers and tank loop), the input
+        // section and the tank stop and the output is dry only, until an input sample reaches
+        // the level again. dBFS, kDefaultSleepThresholdDb by default (-inf: never sleeps).
+        void setSleepThreshold(float thresholdDb);
+
+        // Sample-accurate control change: audio thread only, before the processBlock() call the
+        // offset counts from (later blocks for offsets past its end). Same units as
+        // setControlParameters(), no dead band, ramped from that sample like any control
+        // change. A control later moved on the control thread takes over again.
+        // false: kControlEventCapacity events already pending, the event is dropped.
+        bool scheduleControl(ControlParameter parameter, float value, std::size_t sampleOffset);
+
+        // Stage profile: main loop or host tool (one reader), audio running. getProfile()
+        // is true if 'profile' holds statistics newer than the last read (never when
+        // profiling is compiled out). resetProfile() restarts them at the next block.
+        bool getProfile(Profile& profile) { return mProfiler_.getProfile(profile); }
+        void resetProfile() { mProfiler_.requestReset(); }
+
+        // Processing: audio thread only
+        void processAudioMono(float inputSample);
+        void processAudioStereo(float inputSampleL, float inputSampleR);
+        void processBlock(const float* in, float* out, std::size_t size);
+        void processBlock(const float* inL, const float* inR, float* outL, float* outR, std::size_t size);
 
         // Dry-Wet Mix outputs
         float mOutL, mOutR, mOutMono;
     private:
-        void processAudioPrivate(float inputSample);
+        // Tank topologies, selected once per block by the Smooth switch
+        enum class TankTopology {
+            Plain,          // allpasses 7 - 10 bypassed
+            Smoothed,       // allpasses 7 - 10 in the loop
+            Crossfade       // both, mixed with a ramp while the switch settles
+        };
+
+        // Control values ramped by mSmoothers_ (see beginSmoothedBlock())
+        enum class SmoothedParameter {
+            TankDecay,                                  // ramped per sample
+            DryGain,
+            WetGain,
+            InputLowpassFeedback,                       // stepped per block, at the end value
+            InputHighpassFeedback,
+            InputAllpass1Diffusion,
+            InputAllpass3Diffusion,
+            TankAllpassDiffusion,
+            DriveGain,
+            AtanNorm,
+            TanhNorm,
+            HfDampingFeedback,
+            LfDampingFeedback,
+            ModulationDepth
+        };
+        static constexpr std::size_t kNumSmoothedParameters = 14;
+        static constexpr std::size_t smoothedIndex(SmoothedParameter parameter) { return static_cast<std::size_t>(parameter); }
+
+        // Stages left out of the settled block loops at their neutral control values, where
+        // cookControl() gives them identity coefficients (same samples with or without them)
+        static constexpr unsigned kBypassInputFilters = 1u << 0;    // predelay 0, input lowpass open, highpass at DC
+        static constexpr unsigned kBypassTankHighpass = 1u << 1;    // LF damping at DC
+        static constexpr unsigned kBypassDry = 1u << 2;             // mix at 100 %
+        // Sample-major loop run for a set of bypassed stages: ramped blocks and the crossfade
+        // run every stage, the dry term (one multiply-add) is not worth a specialisation
+        static constexpr unsigned bypassVariant(TankTopology topology, bool ramped, unsigned bypass)
+        {
+            return (ramped || topology == TankTopology::Crossfade) ? 0u : (bypass & (kBypassInputFilters | kBypassTankHighpass));
+        }
+
+        // Tank feedback and per-block constants, kept in registers inside the block loops
+        struct TankState {
+            float accumulator1;
+            float accumulator2;
+            float decay;
+            float decayStep;                            // per-sample ramp increment (ramped blocks only)
+            float smoothMix;                            // 0 = plain, 1 = smoothed (ramped when crossfading)
+            float smoothMixStep;                        // per-sample ramp increment (crossfade only)
+        };
+
+        // Control change scheduled at a sample of a coming block
+        struct ControlEvent {
+            ControlParameter parameter;
+            float value;
+            std::size_t sampleOffset;                   // from the start of the current block
+        };
+
+        // Every cooked control value, handed over as a whole from the control thread to the
+        // audio thread (a block never runs with half an update)
+        struct ControlSnapshot {
+            int predelaySamples;
+            float inputLowpassFeedback;                 // one-pole feedback coefficients of the cutoffs
+            float inputHighpassFeedback;
+            float inputAllpass1Diffusion;               // input allpasses 1/2
+            float inputAllpass3Diffusion;               // input allpasses 3/4
+            float tankDecay;
+            float tankAllpassDiffusion;                 // tank allpasses 5 - 10
+            FastSaturator<>::DriveCoefficients drive;
+            int saturatorOversampling;                  // factor in use (1 near 0 dB drive)
+            int requestedOversampling;                  // factor set by setSaturatorOversampling()
+            SaturatorKernel saturatorKernel;
+            float hfDampingFeedback;
+            float lfDampingFeedback;
+            float dryGain;                              // equal-power mix law
+            float wetGain;
+            int smooth;
+            float modulationDepth;
+            float modulationRate;                       // LFO 1 (LFO 2 follows)
+            float sleepThreshold;                       // linear peak level (0: never sleeps)
+            ProcessMode processMode;
+        };
+
+        static constexpr float kSmoothCrossfadeTime = 0.02f;    // Smooth switch crossfade in seconds
+        static constexpr float kParameterRampTime = 0.02f;      // control value ramps in seconds
+        static constexpr std::size_t kSmoothClearStep = 32;     // idle allpass 7 - 10 samples cleared per block
+        static constexpr std::size_t kSmoothClearLength = Delays::kLongestSmoothAllpass;
+        static constexpr std::size_t kPredelayClearStep = 256;  // predelay samples cleared per block while held at 0
+        static constexpr float kSmoothMixStep = 1.0f/(kSmoothCrossfadeTime*SampleRate);
+        static constexpr float kOversamplingOnDrive = 1.0f;     // saturator oversampling on above this drive (dB)
+        static constexpr float kOversamplingOffDrive = 0.5f;    // and off below this one (hysteresis)
+        static constexpr float kTransparentLowpassFc = 20000.0f;   // input lowpass open at or above (Hz)
+        static constexpr float kTransparentHighpassFc = 12.0f;     // highpasses at DC at or below (panel minimum 10 Hz)
+        static constexpr float kTransparentMix = 99.5f;            // dry path off at or above (%)
+        // Quiet samples before the network sleeps (plus the predelay in use): input diffusers
+        // and one tank loop at full modulation excursion
+        static constexpr std::size_t kSleepHoldSamples = Delays::kInputDiffusion + Delays::kTankLoop +
+                                                         static_cast<std::size_t>(kModDepth1 + kModDepth2);
+        static constexpr std::size_t kSleepClearStep = 64;      // samples of every line cleared per sleeping block
+        static constexpr std::size_t kSleepClearLength = static_cast<std::size_t>(     // longest buffer to clear
+            maxDelay(maxDelay(static_cast<int>(kPredelaySize), static_cast<int>(kModAllpass2Size)), Delays::kLongestFixedDelay));
 
-        /* ----------------------------- Outputs ---------------------------- */
-        // FX 100% wet outputs
-        float mOutWetL_, mOutWetR_;
+        static_assert(kStageBlockSize >= 1, "ReverbZ: tank delays 2/4 must be at least one sample long");
+        static_assert(Storage != DelayStorage::Shared || std::is_same<TankFormat, Float32Format>::value,
+                      "ReverbZ: shared delay storage is float only");
 
+        using SharedStorage = std::integral_constant<bool, Storage == DelayStorage::Shared>;
 
+        // Size and access rate of the external delay buffers, in bindDelayBuffers() order
+        void getDelayBufferRequests(BufferRequest* requests, std::false_type) const;
+        void getDelayBufferRequests(BufferRequest* requests, std::true_type) const;
+        void bindDelayBuffers(const BufferRequest* requests, std::false_type);
+        void bindDelayBuffers(const BufferRequest* requests, std::true_type);
+        void initPrivate(const BufferRequest* requests);
+
+        // Control thread: cook the saturator oversampling factor from the drive
+        void updateSaturatorOversampling(float drive);
+        // Control thread: true if the input moved out of its dead band (its coefficients need cooking)
+        bool updateControl(ControlParameter parameter, float value);
+        // Either thread: the coefficients of one control input (no libm call: see ControlTables.hpp)
+        static void cookControl(ControlSnapshot& controls, ControlParameter parameter, float value);
+        // Control thread: hand the cooked snapshot over if anything changed
+        void publishControls();
+        // Audio thread: take the latest snapshot, if any, and apply what changed
+        void adoptControls();
+        void applyControls(const ControlSnapshot& controls);
+        // Audio thread: apply the scheduled events due at 'offset' into the current block
+        void applyDueControlEvents(std::size_t offset);
+        // Processing of a block (or of a part of it split at a control event) with the controls in place
+        void processSegment(const float* in, float* out, std::size_t size);
+        void processSegment(const float* inL, const float* inR, float* outL, float* outR, std::size_t size);
+        // Audio thread: move the control ramps over the next block. true: the block is ramped
+        // (decay and mix per sample in the kernels, the other coefficients stepped here)
+        bool beginSmoothedBlock(std::size_t size);
+        void endSmoothedBlock();
+        // Coefficients of the smoothed values, all of them or those that moved in the last block
+        void applySmoothedCoefficients(bool all);
+        // Modulation excursion: depth control scaled by the topology mix (none on the plain tank)
+        void updateModulationDepth();
+
+        TankState loadTankState() const;
+        void storeTankState(const TankState& tankState);
+        TankTopology selectTankTopology();
+        void updateTankTopology(TankTopology processedTopology, std::size_t size);
+        // Move the shared delay network on once all lines processed 'size' samples
+        inline void advanceDelayNetwork(std::size_t size);
+        // Bypassed filters are held cleared: they come back in from a clean state
+        void clearBypassedStates(unsigned bypass);
+        // Predelay held at 0 (not written): cleared a step per block before it is read again
+        void clearIdlePredelay();
+        // Plain tank: LFOs not evaluated, only their phase moved on by 'size' samples
+        template<TankTopology Topology>
+        void skipModulation(std::size_t size);
+
+        // Silence sleep: peak level of a block of input, and the quiet time count after each
+        // awake segment (falls asleep once the network cannot hold anything above threshold)
+        static float getPeakLevel(const float* input, std::size_t size);
+        void updateSleep(float inputPeak, std::size_t size);
+        void fallAsleep();
+        // Sleeping segment: dry only, the network cleared a step at a time
+        void processAsleep(const float* in, float* out, std::size_t size);
+        void processAsleep(const float* inL, const float* inR, float* outL, float* outR, std::size_t size);
+        void clearSleepingNetwork();
+
+        // Block processing, one specialisation per tank topology, with and without control ramps
+        // (Ramped = false: no ramp code at all in the loops once the controls settled).
+        // 'bypass': kBypass... stages left out (settled blocks only)
+        template<TankTopology Topology, bool Ramped>
+        void processBlockPrivate(const float* in, float* out, std::size_t size, unsigned bypass);
+        template<TankTopology Topology, bool Ramped>
+        void processBlockPrivate(const float* inL, const float* inR, float* outL, float* outR, std::size_t size, unsigned bypass);
+        // Sample-major block loops, one more specialisation per set of bypassed stages
+        template<TankTopology Topology, bool Ramped, unsigned Bypass>
+        void processSamplesPrivate(const float* in, float* out, std::size_t size);
+        template<TankTopology Topology, bool Ramped, unsigned Bypass>
+        void processSamplesPrivate(const float* inL, const float* inR, float* outL, float* outR, std::size_t size);
+
+        // Core Mono->Stereo per-sample kernel. Tank feedback is passed in/out by reference
+        // so the block loops can keep it in registers (stored back once per block).
+        // 'probe': profiler lap chained through the stages (the output taps are left to the caller)
+        template<TankTopology Topology, bool Ramped, unsigned Bypass>
+        inline void processAudioPrivate(float inputSample, TankState& tankState, float& outWetL, float& outWetR, CycleCounter::Count& probe);
+        // Stage-major kernel: wet outputs of a chunk of at most kStageBlockSize samples
+        // (bypassed stages skipped chunk by chunk, no specialisation needed)
+        template<TankTopology Topology, bool Ramped>
+        void processStagesPrivate(const float* input, float* outWetL, float* outWetR, std::size_t size, unsigned bypass, CycleCounter::Count& probe);
+
+        // Block-processed lines: own buffer (plain or masked), or a region of mSharedMemory_
+        template<std::size_t Capacity, typename Format>
+        using LineRingBuffer = typename std::conditional<Storage == DelayStorage::Shared, SharedRingBuffer,
+                               typename std::conditional<Storage == DelayStorage::PerLineMasked, MaskedRingBuffer<Capacity, Format>,
+                                                         BlockRingBuffer<Capacity, Format>>::type>::type;
+        template<std::size_t Capacity, typename Format = Float32Format>
+        using FixedAllPass = BlockAllPass<Capacity, LineRingBuffer<Capacity, Format>>;
+        template<std::size_t Capacity, typename Format = Float32Format>
+        using FixedDelayLine = BlockDelayLine<Capacity, LineRingBuffer<Capacity, Format>>;
+        using TankSample = typename TankFormat::Type;
 
         /* ------------------------------------------------------------------ */
         /*         All internal dspLib components as member variables         */
         /* ------------------------------------------------------------------ */
-        int mFs_;                                       // Project's sampling frequency
-        const int mFsDattorro_ = 29761;                 // Dattorro's original sampling frequency
+        /* ------------------------- CONTROL THREAD SIDE ------------------------ */
+        TrackedParameter mControls_[kNumControlParameters];     // last cooked value of each input
+        ControlSnapshot mCookedControls_;               // next snapshot to publish
+        bool mIsControlsPending_ = false;               // mCookedControls_ changed since the last publish
+        bool mIsOversamplingActive_ = false;            // drive far enough from 0 dB
+        SnapshotExchange<ControlSnapshot> mControlExchange_;
+
+        /* ------------------------- AUDIO THREAD SIDE ------------------------- */
+        ControlSnapshot mAppliedControls_;              // snapshot the graph runs with (scheduled events included)
+        ControlSnapshot mAdoptedControls_;              // last snapshot of the control thread
+        EventQueue<ControlEvent, kControlEventCapacity> mControlEvents_;   // scheduled, in time order
+        bool mIsControlsApplied_ = false;               // false: next snapshot is applied in full
+        ProcessMode mProcessMode_ = ProcessMode::SampleMajor;
+        SmootherBank<kNumSmoothedParameters> mSmoothers_;   // ramps of the SmoothedParameter values
+        unsigned mBypassedStages_ = 0;                  // kBypass... stages at their neutral values
+        SharedDelayMemory mSharedMemory_;               // delay network storage (DelayStorage::Shared only)
+        Profiler mProfiler_;                            // empty unless PROJLIB_STAGE_PROFILING
 
         /* ---------------------------- INPUT SECTION --------------------------- */
-        // Predelay - DelayLine Object
-        dspLib::DelayLine<MaxSamples> mPredelay_;                           
+        // Predelay - BlockDelayLine Object
+        BlockDelayLine<kPredelaySize> mPredelay_;
+        float mPredelayMemory_[kPredelaySize];          // its storage (in the object)
         float mPredelayTime_ = 0.0f;
-        float mPredelayOut_;                            // delay line out
+        std::size_t mPredelayClearOffset_ = kPredelaySize;  // cleared samples (newest first) of the predelay held at 0
         
         // Input Lowpass Filter    
-        dspLib::OnePoleFilter mInputLowpass_;                          
-        float mInputLowpassOut_;                        // filter output
+        FastOnePole mInputLowpass_;
         
         // Input Highpass Filter
-        dspLib::OnePoleFilter mInputHighpass_;          // input highpass variables
-        float mInputHighpassOut_;                       // filter output
+        FastOnePole mInputHighpass_;                    // input highpass variables
         
         // Input Diffusers - AllPass Objects
-        dspLib::AllPass<MaxSamples> mInputAllpass1_;    // input diffusion all-passes variables
-        float mInputAllpass1Out_;                       // filter output
-    
-        dspLib::AllPass<MaxSamples> mInputAllpass2_;
-        float mInputAllpass2Out_;
-        
-        dspLib::AllPass<MaxSamples> mInputAllpass3_;
-        float mInputAllpass3Out_;
-        
-        dspLib::AllPass<MaxSamples> mInputAllpass4_;
-        float mInputAllPass4Out_;
+        FixedAllPass<kInputAllpass1Size> mInputAllpass1_;   // input diffusion all-passes variables
+        FixedAllPass<kInputAllpass2Size> mInputAllpass2_;
+        FixedAllPass<kInputAllpass3Size> mInputAllpass3_;
+        FixedAllPass<kInputAllpass4Size> mInputAllpass4_;
     
         /* ---------------------------- TANK SECTION --------------------------- */
-        // Tank Inputs, Accumulators and Parameters
-        float mTankInput1_ = 0.0f;                      // tank inputs initialised to 0.0
-        float mTankInput2_ = 0.0f;
+        // Tank Accumulators and Parameters
         float mTankAccumulator1_ = 0.0f;                // tank accumulators initialised to 0.0
         float mTankAccumulator2_ = 0.0f;
-        float mTankDecay_ = 0.5f;                       // tank decay control
+        float mTankDecay_ = 0.5f;                       // tank decay control (running value while ramped)
         
         // Tank Allpasses with delayline modulation
-        dspLib::AllPass<MaxSamples> mModAllpass1_;      // modulated tank allpass filters
-        float mModAllpass1Out_;
-        
-        dspLib::AllPass<MaxSamples> mModAllpass2_;
-        float mModAllpass2Out_;
-        
-        dspLib::DelayLine<MaxSamples> mTankDelay1_;     // tank delaylines 1 and 3
-        float mTankDelay1Out_;
+        using ModulationLfos = ModulationEngine<2>;     // LFO k drives modulated allpass k + 1 (sine output)
+        ModulationLfos mModulation_;
+        float mModDepth_ = 1.0f;                        // depth control [0, 1]
+        ModulatedAllPass<kModAllpass1Size, ModInterpolation> mModAllpass1_;   // modulated tank allpass filters
+        ModulatedAllPass<kModAllpass2Size, ModInterpolation> mModAllpass2_;
+        float mModAllpass1Memory_[kModAllpass1Size];    // their storage (in the object, like the predelay)
+        float mModAllpass2Memory_[kModAllpass2Size];
         
-        dspLib::DelayLine<MaxSamples> mTankDelay3_;
-        float mTankDelay3Out_;
+        FixedDelayLine<kTankDelay1Size, TankFormat> mTankDelay1_;   // tank delaylines 1 and 3
+        FixedDelayLine<kTankDelay3Size, TankFormat> mTankDelay3_;
         
-        dspLib::Saturator mSaturator_;
-        float mSaturator1Out_;
-        float mSaturator2Out_;
-        
-        dspLib::OnePoleFilter mTankLowpass1_;           // tank hf damping
-        float mTankLowpass1Out_;
-        
-        dspLib::OnePoleFilter mTankLowpass2_;
-        float mTankLowpass2Out_;
-        
-        dspLib::OnePoleFilter mTankHighpass1_;          // tank highpass
-        float mTankHighpass1Out_;
-        
-        dspLib::OnePoleFilter mTankHighpass2_;
-        float mTankHighpass2Out_;
-        
-        dspLib::AllPass<MaxSamples> mTankAllpass5_;
-        float mTankAllpass5Out_;
+        FastSaturator<> mSaturator_;                    // atan on leg 1, tanh on leg 2
+        SaturatorOversampler mSaturatorOversampler1_;   // oversampled saturation nodes
+        SaturatorOversampler mSaturatorOversampler2_;
+
+        FastOnePole mTankLowpass1_;                     // tank hf damping
+        FastOnePole mTankLowpass2_;
         
-        dspLib::AllPass<MaxSamples> mTankAllpass6_;
-        float mTankAllpass6Out_;
+        FastOnePole mTankHighpass1_;                    // tank highpass
+        FastOnePole mTankHighpass2_;
         
-        dspLib::DelayLine<MaxSamples> mTankDelay2_;
-        float mTankDelay2Out_;
+        FixedAllPass<kTankAllpass5Size, TankFormat> mTankAllpass5_;
+        FixedAllPass<kTankAllpass6Size, TankFormat> mTankAllpass6_;
         
-        dspLib::DelayLine<MaxSamples> mTankDelay4_;
-        float mTankDelay4Out_;
+        FixedDelayLine<kTankDelay2Size, TankFormat> mTankDelay2_;   // tank delaylines 2 and 4 (read ahead in stage-major mode)
+        FixedDelayLine<kTankDelay4Size, TankFormat> mTankDelay4_;
 
         /* ----------------------- SMOOTH TANK SECTION ----------------------- */
-        int mIsSmoothed_ = 0;
+        int mIsSmoothed_ = 0;                           // Smooth switch target
+        float mSmoothMix_ = 0.0f;                       // current topology mix, 0 = plain, 1 = smoothed
+        float mSmoothMixStep_ = kSmoothMixStep;         // crossfade ramp increment per sample (signed)
+        std::size_t mSmoothClearOffset_ = kSmoothClearLength;   // cleared history (newest first) of the idle allpasses 7 - 10
         
-        dspLib::AllPass<MaxSamples> mTankAllpass7_;
-        float mTankAllpass7Out_;
-        
-        dspLib::AllPass<MaxSamples> mTankAllpass8_;
-        float mTankAllpass8Out_;
-        
-        dspLib::AllPass<MaxSamples> mTankAllpass9_;
-        float mTankAllpass9Out_;
-        
-        dspLib::AllPass<MaxSamples> mTankAllpass10_;
-        float mTankAllpass10Out_;
+        FixedAllPass<kTankAllpass7Size, TankFormat> mTankAllpass7_;
+        FixedAllPass<kTankAllpass8Size, TankFormat> mTankAllpass8_;
+        FixedAllPass<kTankAllpass9Size, TankFormat> mTankAllpass9_;
+        FixedAllPass<kTankAllpass10Size, TankFormat> mTankAllpass10_;
         
         /* ------------------------------ DRY / WET ----------------------------- */
-        float mDryWetMix_;
+        float mDryGain_;                                // running values while ramped
+        float mWetGain_;
+
+        /* ---------------------------- SILENCE SLEEP --------------------------- */
+        bool mIsAsleep_ = false;                        // input section and tank stopped, dry only
+        float mSleepThreshold_ = 0.0f;                  // linear peak level
+        std::size_t mQuietSamples_ = 0;                 // awake samples since the last loud one
+        std::size_t mSleepClearOffset_ = kSleepClearLength;     // lazy clear progress of the sleeping network
+
+        /* ------------------------ STAGE-MAJOR SCRATCH ------------------------ */
+        float mStageInput_[kStageBlockSize];            // mono input
+        float mStageDiffused_[kStageBlockSize];         // input section output
+        float mStageTank1_[kStageBlockSize];            // tank leg 1 working buffer
+        float mStageTank2_[kStageBlockSize];            // tank leg 2 working buffer
+        float mStageModulation1_[kStageBlockSize];      // modulated allpasses delay offsets
+        float mStageModulation2_[kStageBlockSize];
+        float mStageDelay1_[kStageBlockSize];           // output taps
+        float mStageDelay2_[kStageBlockSize];
+        float mStageDelay3_[kStageBlockSize];
+        float mStageDelay4_[kStageBlockSize];
+        float mStageAllpass7_[kStageBlockSize];
+        float mStageAllpass8_[kStageBlockSize];
+        float mStageAllpass9_[kStageBlockSize];
+        float mStageAllpass10_[kStageBlockSize];
+        float mStageSmoothMix_[kStageBlockSize];        // topology mix ramp (crossfade only)
+        float mStageDecay_[kStageBlockSize];            // decay ramp (ramped blocks only)
+        float mStageWetL_[kStageBlockSize];             // wet outputs
+        float mStageWetR_[kStageBlockSize];
 };
 
 }   // namespace projLib
@@ -15,17 +15,71 @@ using namespace dspLib;
 
 namespace projLib {
 
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr int ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kStageChunkLimit;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kStageBlockSize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kPredelaySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kInputAllpass1Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kInputAllpass2Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kInputAllpass3Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kInputAllpass4Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModAllpass1Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModAllpass2Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankDelay1Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankDelay2Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankDelay3Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankDelay4Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass5Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass6Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass7Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass8Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass9Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTankAllpass10Size;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kLineMemorySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kDelayMemorySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kArenaMemorySize;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kLineHeadroom;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumDelayBuffers;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kMemoryBytes;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModDepth1;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModDepth2;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModRate1;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kModRate2;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kMaxModRate;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumControlParameters;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kControlEventCapacity;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumProfileStages;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSmoothCrossfadeTime;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kParameterRampTime;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kNumSmoothedParameters;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSmoothClearStep;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSmoothClearLength;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kPredelayClearStep;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSmoothMixStep;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kOversamplingOnDrive;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kOversamplingOffDrive;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kDefaultSleepThresholdDb;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTransparentLowpassFc;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTransparentHighpassFc;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kTransparentMix;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr unsigned ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kBypassInputFilters;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr unsigned ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kBypassTankHighpass;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr unsigned ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kBypassDry;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSleepHoldSamples;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSleepClearStep;
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation> constexpr std::size_t ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::kSleepClearLength;
+
 /* ------------------------------- Constructor ------------------------------ */
-template<std::size_t MaxSamples>
-ReverbZ<MaxSamples>::ReverbZ(int sampleRate)
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::ReverbZ()
 : 
 mPredelay_(),
 mInputAllpass1_(),
 mInputAllpass2_(),
 mInputAllpass3_(),
 mInputAllpass4_(),
-mModAllpass1_(0, 1, 0.0f, 0.0f),    // Fixed Modulated AllPass instantiation, init paramters in init().
-mModAllpass2_(0, 1, 0.0f, 0.0f),
+mModAllpass1_(),
+mModAllpass2_(),
 mTankDelay1_(),
 mTankDelay3_(),
 mTankAllpass5_(),
@@ -37,81 +91,394 @@ mTankAllpass8_(),
 mTankAllpass9_(),
 mTankAllpass10_()
 {
-    // Set sample rate from external input.
-    mFs_ = sampleRate;
-
     // NOTE: init() must be called manually after hardware/SDRAM initialization
     // DO NOT call init() here - constructor runs during static initialization
     // before SDRAM is ready!
+
+    // Default dead bands: around the ADC noise of the panel, below audible steps
+    setControlThreshold(ControlParameter::PredelayTime, 0.02f);            // ms, one sample at 48 kHz
+    setControlThreshold(ControlParameter::InputLowpassFc, 0.5f, 0.002f);   // Hz, ~3 cents
+    setControlThreshold(ControlParameter::InputHighpassFc, 0.5f, 0.002f);
+    setControlThreshold(ControlParameter::InputDiffusion, 0.0005f);
+    setControlThreshold(ControlParameter::Decay, 0.0005f);
+    setControlThreshold(ControlParameter::Drive, 0.01f);                   // dB
+    setControlThreshold(ControlParameter::HfDamping, 0.5f, 0.002f);
+    setControlThreshold(ControlParameter::LfDamping, 0.5f, 0.002f);
+    setControlThreshold(ControlParameter::Mix, 0.05f);                     // %
+
+    // Control defaults (original ReverbZ GUI), handed over by init() until the controls are set
+    ControlSnapshot& controls = mCookedControls_;
+    controls.predelaySamples = 0;
+    cookControl(controls, ControlParameter::InputLowpassFc, 22000.0f);     // open and at DC: bypassed
+    cookControl(controls, ControlParameter::InputHighpassFc, 10.0f);
+    controls.inputAllpass1Diffusion = 0.75f;
+    controls.inputAllpass3Diffusion = 0.625f + (0.75f - 0.5f)/6.0f;
+    controls.tankDecay = 0.5f;
+    controls.tankAllpassDiffusion = 0.5f;
+    controls.drive = FastSaturator<>::computeDrive(0.0f);
+    controls.saturatorOversampling = 1;
+    controls.requestedOversampling = 1;
+    controls.saturatorKernel = SaturatorKernel::Rational;
+    controls.hfDampingFeedback = onePoleFeedback(dspLib::normalizeFreq(5000.0f, SampleRate));
+    cookControl(controls, ControlParameter::LfDamping, 0.0f);
+    cookControl(controls, ControlParameter::Mix, 100.0f);
+    controls.smooth = 0;
+    controls.modulationDepth = 1.0f;
+    controls.modulationRate = kModRate1;
+    controls.sleepThreshold = std::pow(10.0f, kDefaultSleepThresholdDb/20.0f);
+    controls.processMode = ProcessMode::SampleMajor;
+    mAppliedControls_ = controls;
+    mAdoptedControls_ = controls;
 }
 /* ------------------------------- Destructor ------------------------------- */
-template<std::size_t MaxSamples>
-ReverbZ<MaxSamples>::~ReverbZ(){}
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::~ReverbZ(){}
 /* -------------------------------------------------------------------------- */
  
 
 /* -------------------------------------------------------------------------- */
 /*                               Public Methods                               */
 /* -------------------------------------------------------------------------- */
-template<std::size_t MaxSamples>
-void ReverbZ<MaxSamples>::init()       
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::init(float* delayMemory)       
+{
+    // Fixed allpasses and tank delay lines packed back to back in the external
+    // delay memory (kDelayMemorySize floats: one k...Size region each, or the shared buffer)
+    BufferRequest requests[kNumDelayBuffers];
+    getDelayBufferRequests(requests, SharedStorage());
+    float* region = delayMemory;
+    for (std::size_t i = 0; i < kNumDelayBuffers; i++)
+    {
+        requests[i].buffer = region;
+        requests[i].tier = MemoryTier::Sdram;
+        region += requests[i].size;
+    }
+    initPrivate(requests);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::init(TieredArena& arena)
+{
+    // Fixed allpasses and tank delay lines placed over the arena tiers by access rate
+    // (the shared buffer is a single block)
+    BufferRequest requests[kNumDelayBuffers];
+    getDelayBufferRequests(requests, SharedStorage());
+    if (!arena.plan(requests, kNumDelayBuffers)) return false;
+    initPrivate(requests);
+    return true;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processAudioMono(float inputSample)
+{
+    /* ------------ Process a single sample here ------------ */
+    // Single sample block: same code path as the block processing
+    processBlock(&inputSample, &mOutMono, 1);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processAudioStereo(float inputSampleL, float inputSampleR)
+{
+    /* ------------ Process a pair of LR samples here ------------ */
+    // Single sample block: same code path as the block processing
+    processBlock(&inputSampleL, &inputSampleR, &mOutL, &mOutR, 1);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlock(const float* in, float* out, std::size_t size)
+{
+    /* ------------ Process a block of mono samples here ------------ */
+    // Subnormals flushed to zero for the whole block (decaying tank and filter states)
+    DenormalGuard denormalGuard;
+    // Latest control snapshot, whole, at the block boundary
+    adoptControls();
+    // Split at the scheduled control events: each part runs with the controls of its first sample
+    // (and where a control ramp ends: ramps last the ramp time, whatever the block sizes)
+    std::size_t start = 0;
+    while (start < size)
+    {
+        applyDueControlEvents(start);
+        const std::size_t end = start + mSmoothers_.getRampEnd(mControlEvents_.nextOffset(size) - start);
+        processSegment(in + start, out + start, end - start);
+        start = end;
+    }
+    mControlEvents_.advance(size);
+    mProfiler_.endBlock(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlock(const float* inL, const float* inR, float* outL, float* outR, std::size_t size)
+{
+    /* ------------ Process a block of LR samples here ------------ */
+    // Subnormals flushed to zero for the whole block (decaying tank and filter states)
+    DenormalGuard denormalGuard;
+    // Latest control snapshot, whole, at the block boundary
+    adoptControls();
+    // Split at the scheduled control events: each part runs with the controls of its first sample
+    // (and where a control ramp ends: ramps last the ramp time, whatever the block sizes)
+    std::size_t start = 0;
+    while (start < size)
+    {
+        applyDueControlEvents(start);
+        const std::size_t end = start + mSmoothers_.getRampEnd(mControlEvents_.nextOffset(size) - start);
+        processSegment(inL + start, inR + start, outL + start, outR + start, end - start);
+        start = end;
+    }
+    mControlEvents_.advance(size);
+    mProfiler_.endBlock(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setProcessMode(ProcessMode processMode)
+{
+    // Both modes share all the state: switching is seamless
+    mCookedControls_.processMode = processMode;
+    mIsControlsPending_ = true;
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setSaturatorKernel(SaturatorKernel kernel)
+{
+    mCookedControls_.saturatorKernel = kernel;
+    mIsControlsPending_ = true;
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setSaturatorOversampling(int factor)
+{
+    // Still subject to the drive threshold, with the last drive cooked
+    mCookedControls_.requestedOversampling = factor;
+    mIsControlsPending_ = true;
+    updateSaturatorOversampling(mControls_[static_cast<std::size_t>(ControlParameter::Drive)].getValue());
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setModulationDepth(float depth)
+{
+    if (depth < 0.0f) depth = 0.0f;
+    if (depth > 1.0f) depth = 1.0f;
+    mCookedControls_.modulationDepth = depth;
+    mIsControlsPending_ = true;
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setModulationRate(float rateHz)
+{
+    if (rateHz < 0.0f) rateHz = 0.0f;
+    if (rateHz > kMaxModRate) rateHz = kMaxModRate;
+    mCookedControls_.modulationRate = rateHz;
+    mIsControlsPending_ = true;
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setControlThreshold(ControlParameter parameter, float absoluteThreshold, float relativeThreshold)
+{
+    mControls_[static_cast<std::size_t>(parameter)].setThreshold(absoluteThreshold, relativeThreshold);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setSleepThreshold(float thresholdDb)
+{
+    // Set once in a while: libm is fine here (-inf dB gives 0, which no level is below)
+    mCookedControls_.sleepThreshold = std::pow(10.0f, thresholdDb/20.0f);
+    mIsControlsPending_ = true;
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::setControlParameters(float predelayTime,
+                                    float inputLowpassFc,
+                                    float inputHighpassFc,
+                                    float inputDiffusion,
+                                    float decay,
+                                    float drive,
+                                    float hfDampingFc,
+                                    float lfDampingFc,
+                                    float mixPercentage,
+                                    int smooth)
+{
+    // Called every control tick with every value: each group of coefficients is
+    // only cooked when its input left its dead band (see setControlThreshold()).
+    // Everything lands in mCookedControls_, published once at the end.
+    ControlSnapshot& controls = mCookedControls_;
+    const float values[kNumControlParameters] = {predelayTime, inputLowpassFc, inputHighpassFc, inputDiffusion,
+                                                 decay, drive, hfDampingFc, lfDampingFc, mixPercentage};     // in ControlParameter order
+    for (std::size_t i = 0; i < kNumControlParameters; i++)
+    {
+        const ControlParameter parameter = static_cast<ControlParameter>(i);
+        if (!updateControl(parameter, values[i])) continue;
+        cookControl(controls, parameter, values[i]);
+        if (parameter == ControlParameter::Drive) updateSaturatorOversampling(values[i]);
+    }
+
+    /* ------------ SMOOTH ON/OFF [true, false] ------------ */
+    // Only the target is set here: the tank topology and the modulation depth
+    // follow at the next block boundary, through a short crossfade.
+    if (smooth != controls.smooth)
+    {
+        controls.smooth = smooth;
+        mIsControlsPending_ = true;
+    }
+
+    publishControls();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::scheduleControl(ControlParameter parameter, float value, std::size_t sampleOffset)
+{
+    // Cooked when due, in the audio thread: table lookups only
+    ControlEvent event;
+    event.parameter = parameter;
+    event.value = value;
+    event.sampleOffset = sampleOffset;
+    return mControlEvents_.push(event);
+}
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::getDelayBufferRequests(BufferRequest* requests, std::false_type) const
+{
+    // Every line is read and written once per sample: the planner ranks them by size.
+    // Except tank allpasses 7 - 10, idle with Smooth off (the default): ranked at a quarter
+    // of the rate, they go after every line that always runs (with Smooth on they may run
+    // from a slower tier than their size alone would get them)
+    const BufferRequest table[kNumDelayBuffers] = {
+        {"inputAllpass1", kInputAllpass1Size, 2.0f, nullptr, MemoryTier::Sdram},
+        {"inputAllpass2", kInputAllpass2Size, 2.0f, nullptr, MemoryTier::Sdram},
+        {"inputAllpass3", kInputAllpass3Size, 2.0f, nullptr, MemoryTier::Sdram},
+        {"inputAllpass4", kInputAllpass4Size, 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankDelay1", sampleStorageFloats<TankFormat>(kTankDelay1Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankDelay2", sampleStorageFloats<TankFormat>(kTankDelay2Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankDelay3", sampleStorageFloats<TankFormat>(kTankDelay3Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankDelay4", sampleStorageFloats<TankFormat>(kTankDelay4Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass5", sampleStorageFloats<TankFormat>(kTankAllpass5Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass6", sampleStorageFloats<TankFormat>(kTankAllpass6Size), 2.0f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass7", sampleStorageFloats<TankFormat>(kTankAllpass7Size), 0.5f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass8", sampleStorageFloats<TankFormat>(kTankAllpass8Size), 0.5f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass9", sampleStorageFloats<TankFormat>(kTankAllpass9Size), 0.5f, nullptr, MemoryTier::Sdram},
+        {"tankAllpass10", sampleStorageFloats<TankFormat>(kTankAllpass10Size), 0.5f, nullptr, MemoryTier::Sdram}
+    };
+    for (std::size_t i = 0; i < kNumDelayBuffers; i++) requests[i] = table[i];
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::getDelayBufferRequests(BufferRequest* requests, std::true_type) const
+{
+    // One buffer for the whole network, touched twice per sample by every line
+    requests[0] = {"sharedDelayMemory", kDelayMemorySize, 28.0f, nullptr, MemoryTier::Sdram};
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::bindDelayBuffers(const BufferRequest* requests, std::false_type)
+{
+    // One buffer per line, in getDelayBufferRequests() order
+    mInputAllpass1_.init(requests[0].buffer);
+    mInputAllpass2_.init(requests[1].buffer);
+    mInputAllpass3_.init(requests[2].buffer);
+    mInputAllpass4_.init(requests[3].buffer);
+    mTankDelay1_.init(reinterpret_cast<TankSample*>(requests[4].buffer));
+    mTankDelay2_.init(reinterpret_cast<TankSample*>(requests[5].buffer));
+    mTankDelay3_.init(reinterpret_cast<TankSample*>(requests[6].buffer));
+    mTankDelay4_.init(reinterpret_cast<TankSample*>(requests[7].buffer));
+    mTankAllpass5_.init(reinterpret_cast<TankSample*>(requests[8].buffer));
+    mTankAllpass6_.init(reinterpret_cast<TankSample*>(requests[9].buffer));
+    mTankAllpass7_.init(reinterpret_cast<TankSample*>(requests[10].buffer));
+    mTankAllpass8_.init(reinterpret_cast<TankSample*>(requests[11].buffer));
+    mTankAllpass9_.init(reinterpret_cast<TankSample*>(requests[12].buffer));
+    mTankAllpass10_.init(reinterpret_cast<TankSample*>(requests[13].buffer));
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::bindDelayBuffers(const BufferRequest* requests, std::true_type)
+{
+    // Every line owns a k...Size region of the shared buffer and writes 'delay' samples
+    // into it, so its reads, block writes ahead and history stay inside the region
+    mSharedMemory_.init(requests[0].buffer, kDelayMemorySize);
+    std::size_t region = 0;
+    mInputAllpass1_.getRingBuffer().init(&mSharedMemory_, region + Delays::kInputAllpass1);    region += kInputAllpass1Size;
+    mInputAllpass2_.getRingBuffer().init(&mSharedMemory_, region + Delays::kInputAllpass2);    region += kInputAllpass2Size;
+    mInputAllpass3_.getRingBuffer().init(&mSharedMemory_, region + Delays::kInputAllpass3);    region += kInputAllpass3Size;
+    mInputAllpass4_.getRingBuffer().init(&mSharedMemory_, region + Delays::kInputAllpass4);    region += kInputAllpass4Size;
+    mTankDelay1_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankDelay1);          region += kTankDelay1Size;
+    mTankDelay2_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankDelay2);          region += kTankDelay2Size;
+    mTankDelay3_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankDelay3);          region += kTankDelay3Size;
+    mTankDelay4_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankDelay4);          region += kTankDelay4Size;
+    mTankAllpass5_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass5);      region += kTankAllpass5Size;
+    mTankAllpass6_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass6);      region += kTankAllpass6Size;
+    mTankAllpass7_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass7);      region += kTankAllpass7Size;
+    mTankAllpass8_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass8);      region += kTankAllpass8Size;
+    mTankAllpass9_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass9);      region += kTankAllpass9Size;
+    mTankAllpass10_.getRingBuffer().init(&mSharedMemory_, region + Delays::kTankAllpass10);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::initPrivate(const BufferRequest* requests)
 {
     /* ------------ Allocate Buffers for AllPasses and DelayLines ----------- */
-    mPredelay_.init();
-    mInputAllpass1_.init();
-    mInputAllpass2_.init();
-    mInputAllpass3_.init();
-    mInputAllpass4_.init();
-    mModAllpass1_.init();
-    mModAllpass2_.init();
-    mTankDelay1_.init();
-    mTankDelay3_.init();
-    mTankAllpass5_.init();
-    mTankAllpass6_.init();
-    mTankDelay2_.init();
-    mTankDelay4_.init();
-    mTankAllpass7_.init();
-    mTankAllpass8_.init();
-    mTankAllpass9_.init();
-    mTankAllpass10_.init();  
+    mPredelay_.init(mPredelayMemory_);
+    mPredelayClearOffset_ = kPredelaySize;
+    mModAllpass1_.init(mModAllpass1Memory_);
+    mModAllpass2_.init(mModAllpass2Memory_);
+    bindDelayBuffers(requests, SharedStorage());
     /* -------------------- Set static object parameters -------------------- */
     float modAllpassesFeedbackCoef = 0.70f;
     
-    /* -- convert Dattorro's delay times based on the current sampling rate - */
-    // Cast integer sampling rates to float to avoid integer division (-> 48000/29761 = 1)
-    float mFsFloat = static_cast<float>(mFs_);
-    float mFsDattorroFloat = static_cast<float>(mFsDattorro_);
+    /* ---- Dattorro's delay times, scaled to SampleRate at compile time ---- */
     // Input Allpasses
-    mInputAllpass1_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 142)));
-    mInputAllpass2_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 107)));
-    mInputAllpass3_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 379)));
-    mInputAllpass4_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 277)));
+    mInputAllpass1_.setDelaySamples(Delays::kInputAllpass1);
+    mInputAllpass2_.setDelaySamples(Delays::kInputAllpass2);
+    mInputAllpass3_.setDelaySamples(Delays::kInputAllpass3);
+    mInputAllpass4_.setDelaySamples(Delays::kInputAllpass4);
     // Tank modulated allpasses
-    mModAllpass1_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 672)));
-    mModAllpass2_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 908)));
+    mModAllpass1_.setDelaySamples(Delays::kModAllpass1);
+    mModAllpass2_.setDelaySamples(Delays::kModAllpass2);
     mModAllpass1_.setFeedbackCoefficient(modAllpassesFeedbackCoef);
     mModAllpass2_.setFeedbackCoefficient(modAllpassesFeedbackCoef);
     // Tank delay lines
-    mTankDelay1_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 4453)));
-    mTankDelay3_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 3720)));
-    mTankDelay2_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 4217)));
-    mTankDelay4_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 3163)));
+    mTankDelay1_.setDelaySamples(Delays::kTankDelay1);
+    mTankDelay3_.setDelaySamples(Delays::kTankDelay3);
+    mTankDelay2_.setDelaySamples(Delays::kTankDelay2);
+    mTankDelay4_.setDelaySamples(Delays::kTankDelay4);
     // Tank non-modulated allpasses
-    mTankAllpass5_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 1800)));
-    mTankAllpass6_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 2656)));
+    mTankAllpass5_.setDelaySamples(Delays::kTankAllpass5);
+    mTankAllpass6_.setDelaySamples(Delays::kTankAllpass6);
     // (delay times for allpass 7-10 are prime numbers)
-    mTankAllpass7_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 1511)));
-    mTankAllpass8_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 2003)));
-    mTankAllpass9_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 1709)));
-    mTankAllpass10_.setDelaySamples(static_cast<int>(round(mFsFloat/mFsDattorroFloat * 2411))); 
+    mTankAllpass7_.setDelaySamples(Delays::kTankAllpass7);
+    mTankAllpass8_.setDelaySamples(Delays::kTankAllpass8);
+    mTankAllpass9_.setDelaySamples(Delays::kTankAllpass9);
+    mTankAllpass10_.setDelaySamples(Delays::kTankAllpass10);
+
+    /* Smooth switch crossfade and lazy clear of the idle allpasses 7 - 10 */
+    mSmoothMixStep_ = kSmoothMixStep;
+    mSmoothClearOffset_ = kSmoothClearLength;           // buffers are already clear after init
 
     /* Init Modulated AllPasses' LFOs*/
-    mModAllpass1_.mLFO.setSamplingFrequency(mFs_);
-    mModAllpass2_.mLFO.setSamplingFrequency(mFs_);
-    mModAllpass1_.mLFO.setFrequencyOscillator(0.6f);      // Fixed frequencies
-    mModAllpass2_.mLFO.setFrequencyOscillator(0.8f);      // Fixed frequencies
-    mModAllpass1_.mLFO.init();
-    mModAllpass2_.mLFO.init();
+    mModulation_.init(static_cast<float>(SampleRate));          // rates set with the controls
+    // Plain tank at start: no delay line modulation (ramped in by the Smooth crossfade)
+    updateModulationDepth();
+
+    /* Silence sleep: awake, nothing left to clear */
+    mIsAsleep_ = false;
+    mQuietSamples_ = 0;
+    mSleepClearOffset_ = kSleepClearLength;
+
+    /* Stage profile (PROJLIB_STAGE_PROFILING builds only) */
+    mProfiler_.init();
+
+    /* Control ramps: values jump to the first snapshot, ramp from there on */
+    mSmoothers_.init(static_cast<float>(SampleRate), kParameterRampTime);
+
+    /* Controls: the whole cooked snapshot (defaults or values set so far) at the first block */
+    mControlEvents_.clear();
+    mIsControlsApplied_ = false;
+    mIsControlsPending_ = true;
+    publishControls();
 
 
     /* Original reverbz GUI control defaults. Not necessary if params are set and updated at runtime
@@ -128,209 +495,1193 @@ void ReverbZ<MaxSamples>::init()
     */
 }
 
-template<std::size_t MaxSamples>
-void ReverbZ<MaxSamples>::processAudioMono(float inputSample)
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::updateSaturatorOversampling(float drive)
 {
-    /* ------------ Process a single sample here ------------ */
-    // Core processing is Mono->Stereo
-    processAudioPrivate(inputSample);
+    // Near 0 dB the curves barely bend and alias nothing audible: oversampling off.
+    // Hysteresis keeps a noisy drive knob from toggling it (each toggle clears the filters).
+    if (drive > kOversamplingOnDrive) mIsOversamplingActive_ = true;
+    if (drive < kOversamplingOffDrive) mIsOversamplingActive_ = false;
 
-    // Dry/Wet -> Stereo to mono 
-    float outWetMono = (mOutWetL_ + mOutWetR_)/2.0f;
-    mOutMono = inputSample*(1.0f - mDryWetMix_) + outWetMono*mDryWetMix_;
+    const int factor = mIsOversamplingActive_ ? mCookedControls_.requestedOversampling : 1;
+    if (factor == mCookedControls_.saturatorOversampling) return;
+    mCookedControls_.saturatorOversampling = factor;
+    mIsControlsPending_ = true;
 }
 
-template<std::size_t MaxSamples>
-void ReverbZ<MaxSamples>::processAudioStereo(float inputSampleL, float inputSampleR)
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::updateControl(ControlParameter parameter, float value)
 {
-    /* ------------ Process a pair of LR samples here ------------ */
-    // Stereo->Mono. Core processing is Mono->Stereo
-    float inputSample = (inputSampleL + inputSampleR)/2.0f;
-    processAudioPrivate(inputSample);
+    if (!mControls_[static_cast<std::size_t>(parameter)].update(value)) return false;
+    mIsControlsPending_ = true;
+    return true;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::cookControl(ControlSnapshot& controls, ControlParameter parameter, float value)
+{
+    switch (parameter)
+    {
+        /* ------------ PREDELAY range [0,inf] ------------ */
+        // Predelay time [input in ms]
+        case ControlParameter::PredelayTime:
+        {
+            // Rounded in float (no libm on the audio thread), negative times to 0 (bypassed)
+            int predelaySamples = static_cast<int>(value*SampleRate/1000.0f + 0.5f);
+            if (predelaySamples < 0) predelaySamples = 0;
+            if (predelaySamples > static_cast<int>(MaxPredelaySamples)) predelaySamples = static_cast<int>(MaxPredelaySamples);
+            controls.predelaySamples = predelaySamples;
+            // TODO: control not only predelay but the global delays of all allpasses.
+            break;
+        }
 
-    // Dry/Wet
-    mOutL = inputSampleL*(1.0f - mDryWetMix_) + mOutWetL_*mDryWetMix_;
-    mOutR = inputSampleR*(1.0f - mDryWetMix_) + mOutWetR_*mDryWetMix_;
+        /* ------------ INPUT LP FC range [0Hz, 24kHz] ------------ */
+        // Input lowpass cutoff frequency [input in Hz]. Open at the top of the range:
+        // b = 0 passes the input through, and the stage is bypassed (see applyControls())
+        case ControlParameter::InputLowpassFc:
+            controls.inputLowpassFeedback = (value >= kTransparentLowpassFc) ? 0.0f : onePoleFeedback(dspLib::normalizeFreq(value, SampleRate));
+            break;
+
+        /* ------------ INPUT HP FC range [0Hz, 24kHz] ------------ */
+        // Input highpass cutoff frequency [input in Hz]. At DC at the bottom of the range:
+        // b = 1 (with a cleared state) passes the input through, the stage is bypassed
+        case ControlParameter::InputHighpassFc:
+            controls.inputHighpassFeedback = (value <= kTransparentHighpassFc) ? 1.0f : onePoleFeedback(dspLib::normalizeFreq(value, SampleRate));
+            break;
+
+        /* ------------ INPUT DIFFUSION range [0,1] ------------ */
+        // input diffusion 3 gets varied along with diffusion 1
+        // might change to /6?
+        case ControlParameter::InputDiffusion:
+            controls.inputAllpass1Diffusion = value;
+            controls.inputAllpass3Diffusion = 0.625f + (value - 0.5f)/6.0f;
+            break;
+
+        /* ------------ TANK DECAY range [0,1] ------------ */
+        // decay also affects the allpasses feedback in the tank (values taken from dattorro's)
+        case ControlParameter::Decay:
+        {
+            controls.tankDecay = value;
+            float tankAllpassDiffusion = value + 0.15f;
+            if (tankAllpassDiffusion < 0.15f) tankAllpassDiffusion = 0.15f;
+            if (tankAllpassDiffusion > 0.50f) tankAllpassDiffusion = 0.50f;
+            controls.tankAllpassDiffusion = tankAllpassDiffusion;
+            break;
+        }
+
+        /* ------------ TANK DRIVE range [0dB,inf] ------------ */
+        // Drive gain and curve normalisations (tabulated over the panel range: no pow/atan/tanh)
+        case ControlParameter::Drive:
+            controls.drive = FastSaturator<>::computeDrive(value);
+            break;
+
+        /* ------------ TANK HF DAMPING [0Hz, 24kHz] ------------ */
+        case ControlParameter::HfDamping:
+            controls.hfDampingFeedback = onePoleFeedback(dspLib::normalizeFreq(value, SampleRate));
+            break;
+
+        /* ------------ TANK LF DAMPING [0Hz, 24kHz] ------------ */
+        // Tank highpasses at DC at the bottom of the range: bypassed, like the input one
+        case ControlParameter::LfDamping:
+            controls.lfDampingFeedback = (value <= kTransparentHighpassFc) ? 1.0f : onePoleFeedback(dspLib::normalizeFreq(value, SampleRate));
+            break;
+
+        /* ------------ DRY-WET MIX [0,100] ------------ */
+        // Equal-power law: -3 dB each at 50%, no loudness dip in the middle.
+        // Wet only at the top of the range: the dry path is bypassed.
+        case ControlParameter::Mix:
+            if (value >= kTransparentMix)
+            {
+                controls.dryGain = 0.0f;
+                controls.wetGain = 1.0f;
+                break;
+            }
+            equalPowerGains(value/100.0f, controls.dryGain, controls.wetGain);
+            break;
+    }
 }
 
-template<std::size_t MaxSamples>
-void ReverbZ<MaxSamples>::setControlParameters(float predelayTime,
-                                    float inputLowpassFc,
-                                    float inputHighpassFc,
-                                    float inputDiffusion,
-                                    float decay,
-                                    float drive,
-                                    float hfDampingFc,
-                                    float lfDampingFc,
-                                    float mixPercentage,
-                                    int smooth)
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::publishControls()
 {
-    /* ------------ PREDELAY range [0,inf] ------------ */
-    // Predelay time [input in ms]
-    int predelaySamples = static_cast<int> (round(predelayTime/1000.0f));
-    mPredelay_.setDelaySamples(predelaySamples);
-    // TODO: control not only predelay but the global delays of all allpasses.
-
-    /* ------------ INPUT LP FC range [0Hz, 24kHz] ------------ */
-    // Input lowpass cutoff frequency [input in Hz]
-    float inputLowpassNormWc = dspLib::normalizeFreq(inputLowpassFc, mFs_);
-    mInputLowpass_.setNormalizedCutoffFrequency(inputLowpassNormWc);
-
-    /* ------------ INPUT HP FC range [0Hz, 24kHz] ------------ */
-    // Input highpass cutoff frequency [input in Hz]
-    float inputHighpassNormWc = dspLib::normalizeFreq(inputHighpassFc, mFs_);
-    mInputHighpass_.setNormalizedCutoffFrequency(inputHighpassNormWc);
-
-    /* ------------ INPUT DIFFUSION range [0,1] ------------ */
-    // input diffusion 3 gets varied along with diffusion 1
-    // might change to /6?
-    float inputAllpass1Diffusion = inputDiffusion;
-    float inputAllpass3Diffusion = 0.625f + (inputDiffusion - 0.5f)/6.0f;
-    mInputAllpass1_.setFeedbackCoefficient(inputAllpass1Diffusion);
-    mInputAllpass2_.setFeedbackCoefficient(inputAllpass1Diffusion);
-    mInputAllpass3_.setFeedbackCoefficient(inputAllpass3Diffusion);
-    mInputAllpass4_.setFeedbackCoefficient(inputAllpass3Diffusion);
-
-    /* ------------ TANK DECAY range [0,1] ------------ */
-    // decay also affects the allpasses feedback in the tank (values taken from dattorro's)
-    mTankDecay_ = decay;
-    float tankAllpassDiffusion = mTankDecay_ + 0.15f;
-    if (tankAllpassDiffusion < 0.15f) tankAllpassDiffusion = 0.15f;
-    if (tankAllpassDiffusion > 0.50f) tankAllpassDiffusion = 0.50f;
-    
-    // Update diffusion coefficients of all AllPasses in the tank
-    mTankAllpass5_.setFeedbackCoefficient(tankAllpassDiffusion);
-    mTankAllpass6_.setFeedbackCoefficient(tankAllpassDiffusion);    
-    mTankAllpass7_.setFeedbackCoefficient(tankAllpassDiffusion);
-    mTankAllpass8_.setFeedbackCoefficient(tankAllpassDiffusion);
-    mTankAllpass9_.setFeedbackCoefficient(tankAllpassDiffusion);
-    mTankAllpass10_.setFeedbackCoefficient(tankAllpassDiffusion);
-
-    /* ------------ TANK DRIVE range [0dB,inf] ------------ */
-    mSaturator_.setDrive(drive);
-
-    /* ------------ TANK HF DAMPING [0Hz, 24kHz] ------------ */
-    float normFreqHfDamping = dspLib::normalizeFreq(hfDampingFc, mFs_);
-    mTankLowpass1_.setNormalizedCutoffFrequency(normFreqHfDamping);
-    mTankLowpass2_.setNormalizedCutoffFrequency(normFreqHfDamping);
-
-    /* ------------ TANK LF DAMPING [0Hz, 24kHz] ------------ */
-    float normFreqLfDamping = dspLib::normalizeFreq(lfDampingFc, mFs_);
-    mTankHighpass1_.setNormalizedCutoffFrequency(normFreqLfDamping);
-    mTankHighpass2_.setNormalizedCutoffFrequency(normFreqLfDamping);
-
-    /* ------------ DRY-WET MIX [0,100] ------------ */
-    mDryWetMix_ = mixPercentage/100.0f;
+    // Idle panel: nothing to hand over
+    if (!mIsControlsPending_) return;
+    mControlExchange_.publish(mCookedControls_);
+    mIsControlsPending_ = false;
+}
 
-    /* ------------ SMOOTH ON/OFF [true, false] ------------ */
-    mIsSmoothed_ = smooth;
-    if(mIsSmoothed_)
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::adoptControls()
+{
+    ControlSnapshot controls;
+    if (!mControlExchange_.adopt(controls)) return;
+    const ControlSnapshot adopted = controls;
+
+    // What the control thread left as it was keeps its running value: a scheduled
+    // event holds until its control is moved on the panel (or the host) again
+    if (mIsControlsApplied_)
     {
-        // Set modulation amplitude: max delay samples modulation
-        mModAllpass1_.setModDepth(24.0f);
-        mModAllpass2_.setModDepth(48.0f);
+        const ControlSnapshot& previous = mAdoptedControls_;
+        const ControlSnapshot& running = mAppliedControls_;
+        auto keepRunning = [](auto& value, const auto& previousValue, const auto& runningValue)
+        {
+            if (value == previousValue) value = runningValue;
+        };
+        keepRunning(controls.predelaySamples, previous.predelaySamples, running.predelaySamples);
+        keepRunning(controls.inputLowpassFeedback, previous.inputLowpassFeedback, running.inputLowpassFeedback);
+        keepRunning(controls.inputHighpassFeedback, previous.inputHighpassFeedback, running.inputHighpassFeedback);
+        keepRunning(controls.inputAllpass1Diffusion, previous.inputAllpass1Diffusion, running.inputAllpass1Diffusion);
+        keepRunning(controls.inputAllpass3Diffusion, previous.inputAllpass3Diffusion, running.inputAllpass3Diffusion);
+        keepRunning(controls.tankDecay, previous.tankDecay, running.tankDecay);
+        keepRunning(controls.tankAllpassDiffusion, previous.tankAllpassDiffusion, running.tankAllpassDiffusion);
+        if (controls.drive.driveDb == previous.drive.driveDb) controls.drive = running.drive;
+        keepRunning(controls.saturatorOversampling, previous.saturatorOversampling, running.saturatorOversampling);
+        keepRunning(controls.hfDampingFeedback, previous.hfDampingFeedback, running.hfDampingFeedback);
+        keepRunning(controls.lfDampingFeedback, previous.lfDampingFeedback, running.lfDampingFeedback);
+        keepRunning(controls.dryGain, previous.dryGain, running.dryGain);
+        keepRunning(controls.wetGain, previous.wetGain, running.wetGain);
     }
-    else if(!mIsSmoothed_)
+    applyControls(controls);
+    mAppliedControls_ = controls;
+    mAdoptedControls_ = adopted;
+    mIsControlsApplied_ = true;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::applyControls(const ControlSnapshot& controls)
+{
+    // Only what differs from the running snapshot (all of it after init()): the
+    // skipped intermediate snapshots, if any, are covered as well.
+    const bool all = !mIsControlsApplied_;
+    const ControlSnapshot& applied = mAppliedControls_;
+
+    if (all || controls.predelaySamples != applied.predelaySamples)
+    {
+        // Held at 0 the line is not written: clear it a step per block (see clearIdlePredelay())
+        // rather than replay its stale content later. Used again, it stops clearing.
+        mPredelayClearOffset_ = (!all && controls.predelaySamples == 0) ? 0 : kPredelaySize;
+        mPredelay_.setDelaySamples(controls.predelaySamples);
+    }
+    mSaturator_.setKernel(controls.saturatorKernel);
+    mSaturatorOversampler1_.setFactor(controls.saturatorOversampling);      // filters cleared on change only
+    mSaturatorOversampler2_.setFactor(controls.saturatorOversampling);
+    mIsSmoothed_ = controls.smooth;
+    // Keep the original ratio between the two LFOs, so they never lock together
+    // (rotations recomputed on change only)
+    mModulation_.setRate(0, controls.modulationRate);
+    mModulation_.setRate(1, controls.modulationRate*(kModRate2/kModRate1));
+    mSleepThreshold_ = controls.sleepThreshold;
+
+    // Continuous values ramp from where they are (restarted by a new target), except
+    // after init(): nothing sounded yet, jump to them. In SmoothedParameter order.
+    const float smoothed[kNumSmoothedParameters] = {
+        controls.tankDecay,
+        controls.dryGain,
+        controls.wetGain,
+        controls.inputLowpassFeedback,
+        controls.inputHighpassFeedback,
+        controls.inputAllpass1Diffusion,
+        controls.inputAllpass3Diffusion,
+        controls.tankAllpassDiffusion,
+        controls.drive.gain,
+        controls.drive.atanNorm,
+        controls.drive.tanhNorm,
+        controls.hfDampingFeedback,
+        controls.lfDampingFeedback,
+        controls.modulationDepth
+    };
+    for (std::size_t i = 0; i < kNumSmoothedParameters; i++)
     {
-        // No delay line modulation - modulation depth set to 0.0f if no arguments are passed.
-        mModAllpass1_.setModDepth();
-        mModAllpass2_.setModDepth();
+        if (all) mSmoothers_.setValue(i, smoothed[i]);
+        else     mSmoothers_.setTarget(i, smoothed[i]);
     }
+    if (all) applySmoothedCoefficients(true);
+    mProcessMode_ = controls.processMode;
+
+    // Stages at their identity coefficients (see cookControl()): left out of the block
+    // loops once their ramps have settled there
+    unsigned bypassed = 0;
+    if (controls.predelaySamples == 0 && controls.inputLowpassFeedback == 0.0f && controls.inputHighpassFeedback == 1.0f)
+        bypassed |= kBypassInputFilters;
+    if (controls.lfDampingFeedback == 1.0f) bypassed |= kBypassTankHighpass;
+    if (controls.dryGain == 0.0f) bypassed |= kBypassDry;
+    mBypassedStages_ = bypassed;
 }
-/* -------------------------------------------------------------------------- */
-/*                               Private Methods                              */
-/* -------------------------------------------------------------------------- */
-template<std::size_t MaxSamples>
-void ReverbZ<MaxSamples>::processAudioPrivate(float inputSample)
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::applyDueControlEvents(std::size_t offset)
+{
+    while (mControlEvents_.isDue(offset))
+    {
+        const ControlEvent& event = mControlEvents_.front();
+        ControlSnapshot controls = mAppliedControls_;
+        cookControl(controls, event.parameter, event.value);
+        if (event.parameter == ControlParameter::Drive)
+        {
+            // Oversampling follows the drive with the control thread's thresholds
+            // (in between them the factor in use is kept: same hysteresis)
+            if (event.value > kOversamplingOnDrive) controls.saturatorOversampling = controls.requestedOversampling;
+            if (event.value < kOversamplingOffDrive) controls.saturatorOversampling = 1;
+        }
+        applyControls(controls);
+        mAppliedControls_ = controls;
+        mControlEvents_.pop();
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::beginSmoothedBlock(std::size_t size)
+{
+    if (!mSmoothers_.processBlock(size)) return false;
+
+    // Filter cutoffs, allpass gains, drive and modulation depth: one step per block
+    // along the ramp (recomputing them per sample would cost more than it is worth)
+    applySmoothedCoefficients(false);
+    // Decay and mix: the kernels ramp them per sample from the block start
+    mTankDecay_ = mSmoothers_.getBlockStart(smoothedIndex(SmoothedParameter::TankDecay));
+    mDryGain_ = mSmoothers_.getBlockStart(smoothedIndex(SmoothedParameter::DryGain));
+    mWetGain_ = mSmoothers_.getBlockStart(smoothedIndex(SmoothedParameter::WetGain));
+    return true;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::endSmoothedBlock()
+{
+    // Land on the ramps' end values, without the rounding accumulated by the kernels
+    mTankDecay_ = mSmoothers_.getValue(smoothedIndex(SmoothedParameter::TankDecay));
+    mDryGain_ = mSmoothers_.getValue(smoothedIndex(SmoothedParameter::DryGain));
+    mWetGain_ = mSmoothers_.getValue(smoothedIndex(SmoothedParameter::WetGain));
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::applySmoothedCoefficients(bool all)
+{
+    const SmootherBank<kNumSmoothedParameters>& smoothers = mSmoothers_;
+    auto isMoving = [all, &smoothers](SmoothedParameter parameter) { return all || smoothers.isMoving(smoothedIndex(parameter)); };
+    auto value = [&smoothers](SmoothedParameter parameter) { return smoothers.getValue(smoothedIndex(parameter)); };
+
+    if (all)
+    {
+        mTankDecay_ = value(SmoothedParameter::TankDecay);
+        mDryGain_ = value(SmoothedParameter::DryGain);
+        mWetGain_ = value(SmoothedParameter::WetGain);
+    }
+    if (isMoving(SmoothedParameter::InputLowpassFeedback))
+        mInputLowpass_.setFeedbackCoefficient(value(SmoothedParameter::InputLowpassFeedback));
+    if (isMoving(SmoothedParameter::InputHighpassFeedback))
+        mInputHighpass_.setFeedbackCoefficient(value(SmoothedParameter::InputHighpassFeedback));
+    if (isMoving(SmoothedParameter::InputAllpass1Diffusion))
+    {
+        mInputAllpass1_.setFeedbackCoefficient(value(SmoothedParameter::InputAllpass1Diffusion));
+        mInputAllpass2_.setFeedbackCoefficient(value(SmoothedParameter::InputAllpass1Diffusion));
+    }
+    if (isMoving(SmoothedParameter::InputAllpass3Diffusion))
+    {
+        mInputAllpass3_.setFeedbackCoefficient(value(SmoothedParameter::InputAllpass3Diffusion));
+        mInputAllpass4_.setFeedbackCoefficient(value(SmoothedParameter::InputAllpass3Diffusion));
+    }
+    if (isMoving(SmoothedParameter::TankAllpassDiffusion))
+    {
+        // Update diffusion coefficients of all AllPasses in the tank
+        const float tankAllpassDiffusion = value(SmoothedParameter::TankAllpassDiffusion);
+        mTankAllpass5_.setFeedbackCoefficient(tankAllpassDiffusion);
+        mTankAllpass6_.setFeedbackCoefficient(tankAllpassDiffusion);
+        mTankAllpass7_.setFeedbackCoefficient(tankAllpassDiffusion);
+        mTankAllpass8_.setFeedbackCoefficient(tankAllpassDiffusion);
+        mTankAllpass9_.setFeedbackCoefficient(tankAllpassDiffusion);
+        mTankAllpass10_.setFeedbackCoefficient(tankAllpassDiffusion);
+    }
+    if (isMoving(SmoothedParameter::DriveGain) || isMoving(SmoothedParameter::AtanNorm) || isMoving(SmoothedParameter::TanhNorm))
+    {
+        // Gain and normalisations ramped side by side (no pow/atan/tanh in the callback)
+        FastSaturator<>::DriveCoefficients drive;
+        drive.driveDb = -1.0f;                      // in between settings: no dB value to match
+        drive.gain = value(SmoothedParameter::DriveGain);
+        drive.atanNorm = value(SmoothedParameter::AtanNorm);
+        drive.tanhNorm = value(SmoothedParameter::TanhNorm);
+        mSaturator_.setDrive(drive);
+    }
+    if (isMoving(SmoothedParameter::HfDampingFeedback))
+    {
+        mTankLowpass1_.setFeedbackCoefficient(value(SmoothedParameter::HfDampingFeedback));
+        mTankLowpass2_.setFeedbackCoefficient(value(SmoothedParameter::HfDampingFeedback));
+    }
+    if (isMoving(SmoothedParameter::LfDampingFeedback))
+    {
+        mTankHighpass1_.setFeedbackCoefficient(value(SmoothedParameter::LfDampingFeedback));
+        mTankHighpass2_.setFeedbackCoefficient(value(SmoothedParameter::LfDampingFeedback));
+    }
+    if (isMoving(SmoothedParameter::ModulationDepth))
+    {
+        mModDepth_ = value(SmoothedParameter::ModulationDepth);
+        updateModulationDepth();
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::updateModulationDepth()
+{
+    const float depth = mModDepth_*mSmoothMix_;
+    mModulation_.setDepth(ModulationLfos::sineOutput(0), kModDepth1*depth);
+    mModulation_.setDepth(ModulationLfos::sineOutput(1), kModDepth2*depth);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankState ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::loadTankState() const
+{
+    TankState tankState;
+    tankState.accumulator1 = mTankAccumulator1_;
+    tankState.accumulator2 = mTankAccumulator2_;
+    tankState.decay = mTankDecay_;
+    tankState.decayStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::TankDecay));
+    tankState.smoothMix = mSmoothMix_;
+    tankState.smoothMixStep = mSmoothMixStep_;
+    return tankState;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::storeTankState(const TankState& tankState)
+{
+    // Only the state evolving inside the block is stored back (a dying tank feedback
+    // is flushed to zero, also where the FPU has no flush-to-zero mode)
+    mTankAccumulator1_ = flushDenormal(tankState.accumulator1);
+    mTankAccumulator2_ = flushDenormal(tankState.accumulator2);
+    mTankDecay_ = tankState.decay;
+    mSmoothMix_ = tankState.smoothMix;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::selectTankTopology()
+{
+    // Settled: the mix sits on the Smooth switch target
+    const float smoothTarget = (mIsSmoothed_ == 1) ? 1.0f : 0.0f;
+    if (mSmoothMix_ == smoothTarget)
+        return (mIsSmoothed_ == 1) ? TankTopology::Smoothed : TankTopology::Plain;
+
+    // Otherwise ramp towards the target (the direction may flip mid-crossfade)
+    if ((smoothTarget > mSmoothMix_) != (mSmoothMixStep_ > 0.0f)) mSmoothMixStep_ = -mSmoothMixStep_;
+    return TankTopology::Crossfade;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::updateTankTopology(TankTopology processedTopology, std::size_t size)
+{
+    if (processedTopology == TankTopology::Crossfade)
+    {
+        // Follow the crossfade with the modulation depth (no jump in the read position)
+        updateModulationDepth();
+    }
+
+    if (processedTopology != TankTopology::Plain)
+    {
+        // Allpasses 7 - 10 are running: their history is live
+        mSmoothClearOffset_ = 0;
+        return;
+    }
+
+    // Plain tank: the idle allpasses 7 - 10 move on with the network, writing silence.
+    // Shared storage has to (their regions keep moving along the shared buffer), per-line
+    // storage does the same, so that every storage mode keeps the same history.
+    const bool isClearing = (mSmoothClearOffset_ < kSmoothClearLength);
+    if (Storage == DelayStorage::Shared || isClearing)
+    {
+        mTankAllpass7_.skipSilence(size);
+        mTankAllpass8_.skipSilence(size);
+        mTankAllpass9_.skipSilence(size);
+        mTankAllpass10_.skipSilence(size);
+    }
+    if (!isClearing) return;
+
+    // Behind that silence, clear the stale tail a little per block, newest first, so that
+    // switching Smooth back on does not replay it. Measured from the newest sample, the
+    // cleared region only grows as the lines move.
+    mSmoothClearOffset_ += size;
+    mTankAllpass7_.clearRecent(mSmoothClearOffset_, kSmoothClearStep);
+    mTankAllpass8_.clearRecent(mSmoothClearOffset_, kSmoothClearStep);
+    mTankAllpass9_.clearRecent(mSmoothClearOffset_, kSmoothClearStep);
+    mTankAllpass10_.clearRecent(mSmoothClearOffset_, kSmoothClearStep);
+    mSmoothClearOffset_ += kSmoothClearStep;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+inline void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::advanceDelayNetwork(std::size_t size)
+{
+    // Shared storage: one write index for every line. Per-line buffers advance themselves.
+    if (Storage == DelayStorage::Shared) mSharedMemory_.advance(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::clearBypassedStates(unsigned bypass)
+{
+    // Identity either way (lowpass at b = 0 follows its input, highpass at b = 1 from a
+    // cleared state passes it): once the cutoff moves again the filter starts from rest
+    if (bypass & kBypassInputFilters)
+    {
+        mInputLowpass_.reset();
+        mInputHighpass_.reset();
+    }
+    if (bypass & kBypassTankHighpass)
+    {
+        mTankHighpass1_.reset();
+        mTankHighpass2_.reset();
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::clearIdlePredelay()
+{
+    // Newest samples first: they are the first ones a short predelay time reads back
+    if (mPredelayClearOffset_ >= kPredelaySize) return;
+    mPredelay_.clearBuffer(mPredelayClearOffset_, kPredelayClearStep);
+    mPredelayClearOffset_ += kPredelayClearStep;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::skipModulation(std::size_t size)
+{
+    if (Topology != TankTopology::Plain) return;
+    float* modulation[ModulationLfos::kNumOutputs] = {};
+    mModulation_.processBlock(modulation, size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+float ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::getPeakLevel(const float* input, std::size_t size)
+{
+    float peak = 0.0f;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const float level = std::fabs(input[i]);
+        if (level > peak) peak = level;
+    }
+    return peak;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::updateSleep(float inputPeak, std::size_t size)
+{
+    // Block-level tracking: the input peak and the tank feedback at the block end. Both
+    // quiet for a whole trip through the network, nothing above threshold is left in it.
+    const float tankLevel1 = std::fabs(mTankAccumulator1_);
+    const float tankLevel2 = std::fabs(mTankAccumulator2_);
+    if (inputPeak >= mSleepThreshold_ || tankLevel1 >= mSleepThreshold_ || tankLevel2 >= mSleepThreshold_)
+    {
+        mQuietSamples_ = 0;
+        return;
+    }
+    mQuietSamples_ += size;
+    if (mQuietSamples_ >= kSleepHoldSamples + static_cast<std::size_t>(mAppliedControls_.predelaySamples)) fallAsleep();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::fallAsleep()
+{
+    // Feedback and filter states are dropped at once, the delay memory a step per
+    // sleeping block: by the time the input comes back the network starts from silence
+    // (a wake-up before the clear is done finds sub-threshold leftovers at worst).
+    mIsAsleep_ = true;
+    mQuietSamples_ = 0;
+    mSleepClearOffset_ = 0;
+    mTankAccumulator1_ = 0.0f;
+    mTankAccumulator2_ = 0.0f;
+    mInputLowpass_.reset();
+    mInputHighpass_.reset();
+    mTankLowpass1_.reset();
+    mTankLowpass2_.reset();
+    mTankHighpass1_.reset();
+    mTankHighpass2_.reset();
+    mSaturatorOversampler1_.clear();
+    mSaturatorOversampler2_.clear();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processAsleep(const float* in, float* out, std::size_t size)
+{
+    // The ramps keep moving: a mix or decay change made while asleep is in place on wake-up
+    const bool isRamped = beginSmoothedBlock(size);
+    const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+    CycleCounter::Count probe = mProfiler_.start();
+    float dryGain = mDryGain_;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (isRamped) dryGain += dryGainStep;
+        out[i] = in[i]*dryGain;
+    }
+    mProfiler_.lap(ProfileStage::OutputMix, probe);
+    clearSleepingNetwork();
+    if (isRamped) endSmoothedBlock();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processAsleep(const float* inL, const float* inR, float* outL, float* outR, std::size_t size)
+{
+    // The ramps keep moving: a mix or decay change made while asleep is in place on wake-up
+    const bool isRamped = beginSmoothedBlock(size);
+    const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+    CycleCounter::Count probe = mProfiler_.start();
+    float dryGain = mDryGain_;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (isRamped) dryGain += dryGainStep;
+        outL[i] = inL[i]*dryGain;
+        outR[i] = inR[i]*dryGain;
+    }
+    mProfiler_.lap(ProfileStage::OutputMix, probe);
+    clearSleepingNetwork();
+    if (isRamped) endSmoothedBlock();
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::clearSleepingNetwork()
+{
+    // Nothing sounds through the tank: a Smooth switch change lands without crossfade
+    const float smoothTarget = (mIsSmoothed_ == 1) ? 1.0f : 0.0f;
+    if (mSmoothMix_ != smoothTarget)
+    {
+        mSmoothMix_ = smoothTarget;
+        updateModulationDepth();
+    }
+
+    // The lines do not move while asleep (shared storage included): their histories are
+    // cleared kSleepClearStep samples at a time, each line clipping to its own length
+    if (mSleepClearOffset_ >= kSleepClearLength) return;
+    const std::size_t offset = mSleepClearOffset_;
+    mInputAllpass1_.clearHistory(offset, kSleepClearStep);
+    mInputAllpass2_.clearHistory(offset, kSleepClearStep);
+    mInputAllpass3_.clearHistory(offset, kSleepClearStep);
+    mInputAllpass4_.clearHistory(offset, kSleepClearStep);
+    mModAllpass1_.clearHistory(offset, kSleepClearStep);
+    mModAllpass2_.clearHistory(offset, kSleepClearStep);
+    mTankDelay1_.clearHistory(offset, kSleepClearStep);
+    mTankDelay2_.clearHistory(offset, kSleepClearStep);
+    mTankDelay3_.clearHistory(offset, kSleepClearStep);
+    mTankDelay4_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass5_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass6_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass7_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass8_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass9_.clearHistory(offset, kSleepClearStep);
+    mTankAllpass10_.clearHistory(offset, kSleepClearStep);
+    // The predelay whole, whatever its time (a longer one reads further back)
+    mPredelay_.clearBuffer(offset, kSleepClearStep);
+    mSleepClearOffset_ += kSleepClearStep;
+
+    // Allpasses 7 - 10 are clear as well: nothing left for the Smooth switch clear
+    if (mSleepClearOffset_ >= kSleepClearLength) mSmoothClearOffset_ = kSmoothClearLength;
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processSegment(const float* in, float* out, std::size_t size)
+{
+    // Silence sleep: dry only until an input sample reaches the threshold again
+    const float inputPeak = getPeakLevel(in, size);
+    if (mIsAsleep_)
+    {
+        if (inputPeak < mSleepThreshold_)
+        {
+            processAsleep(in, out, size);
+            return;
+        }
+        mIsAsleep_ = false;
+    }
+
+    // Control ramps over this block: none (and no ramp code in the loops) once settled
+    const bool isRamped = beginSmoothedBlock(size);
+    // Tank topology dispatched once per block: no Smooth branch in the inner loops
+    const TankTopology topology = selectTankTopology();
+    // Neutral stages left out of settled blocks (ramped ones run them, at their identity values)
+    const unsigned bypass = isRamped ? 0u : mBypassedStages_;
+    clearBypassedStates(bypass);
+    clearIdlePredelay();
+    switch (topology)
+    {
+        case TankTopology::Plain:
+            if (isRamped) processBlockPrivate<TankTopology::Plain, true>(in, out, size, bypass);
+            else          processBlockPrivate<TankTopology::Plain, false>(in, out, size, bypass);
+            break;
+        case TankTopology::Smoothed:
+            if (isRamped) processBlockPrivate<TankTopology::Smoothed, true>(in, out, size, bypass);
+            else          processBlockPrivate<TankTopology::Smoothed, false>(in, out, size, bypass);
+            break;
+        case TankTopology::Crossfade:
+            if (isRamped) processBlockPrivate<TankTopology::Crossfade, true>(in, out, size, bypass);
+            else          processBlockPrivate<TankTopology::Crossfade, false>(in, out, size, bypass);
+            break;
+    }
+    updateTankTopology(topology, size);
+    if (isRamped) endSmoothedBlock();
+    updateSleep(inputPeak, size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processSegment(const float* inL, const float* inR, float* outL, float* outR, std::size_t size)
+{
+    // Silence sleep: dry only until an input sample reaches the threshold again
+    const float peakL = getPeakLevel(inL, size);
+    const float peakR = getPeakLevel(inR, size);
+    const float inputPeak = (peakL > peakR) ? peakL : peakR;
+    if (mIsAsleep_)
+    {
+        if (inputPeak < mSleepThreshold_)
+        {
+            processAsleep(inL, inR, outL, outR, size);
+            return;
+        }
+        mIsAsleep_ = false;
+    }
+
+    // Control ramps over this block: none (and no ramp code in the loops) once settled
+    const bool isRamped = beginSmoothedBlock(size);
+    // Tank topology dispatched once per block: no Smooth branch in the inner loops
+    const TankTopology topology = selectTankTopology();
+    // Neutral stages left out of settled blocks (ramped ones run them, at their identity values)
+    const unsigned bypass = isRamped ? 0u : mBypassedStages_;
+    clearBypassedStates(bypass);
+    clearIdlePredelay();
+    switch (topology)
+    {
+        case TankTopology::Plain:
+            if (isRamped) processBlockPrivate<TankTopology::Plain, true>(inL, inR, outL, outR, size, bypass);
+            else          processBlockPrivate<TankTopology::Plain, false>(inL, inR, outL, outR, size, bypass);
+            break;
+        case TankTopology::Smoothed:
+            if (isRamped) processBlockPrivate<TankTopology::Smoothed, true>(inL, inR, outL, outR, size, bypass);
+            else          processBlockPrivate<TankTopology::Smoothed, false>(inL, inR, outL, outR, size, bypass);
+            break;
+        case TankTopology::Crossfade:
+            if (isRamped) processBlockPrivate<TankTopology::Crossfade, true>(inL, inR, outL, outR, size, bypass);
+            else          processBlockPrivate<TankTopology::Crossfade, false>(inL, inR, outL, outR, size, bypass);
+            break;
+    }
+    updateTankTopology(topology, size);
+    if (isRamped) endSmoothedBlock();
+    updateSleep(inputPeak, size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlockPrivate(const float* in, float* out, std::size_t size, unsigned bypass)
+{
+    if (mProcessMode_ == ProcessMode::StageMajor)
+    {
+        const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+        const float wetGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::WetGain));
+        CycleCounter::Count probe = mProfiler_.start();
+        float dryGain = mDryGain_;
+        float wetGain = mWetGain_;
+        while (size > 0)
+        {
+            std::size_t chunk = (size < kStageBlockSize) ? size : kStageBlockSize;
+            processStagesPrivate<Topology, Ramped>(in, mStageWetL_, mStageWetR_, chunk, bypass, probe);
+            advanceDelayNetwork(chunk);
+
+            // Dry/Wet -> Stereo to mono
+            if (bypass & kBypassDry)
+            {
+                for(std::size_t i = 0; i < chunk; i++)
+                    out[i] = (mStageWetL_[i] + mStageWetR_[i])/2.0f*wetGain;
+            }
+            else
+            {
+                for(std::size_t i = 0; i < chunk; i++)
+                {
+                    if (Ramped)
+                    {
+                        dryGain += dryGainStep;
+                        wetGain += wetGainStep;
+                    }
+                    float outWetMono = (mStageWetL_[i] + mStageWetR_[i])/2.0f;
+                    out[i] = in[i]*dryGain + outWetMono*wetGain;
+                }
+            }
+            probe = mProfiler_.lap(ProfileStage::OutputMix, probe);
+            in += chunk;
+            out += chunk;
+            size -= chunk;
+        }
+        return;
+    }
+
+    // Sample-major: one loop per set of bypassed stages (only the full one for ramped
+    // blocks and the crossfade, see bypassVariant())
+    switch (bypassVariant(Topology, Ramped, bypass))
+    {
+        case 0: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 0)>(in, out, size); break;
+        case 1: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 1)>(in, out, size); break;
+        case 2: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 2)>(in, out, size); break;
+        case 3: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 3)>(in, out, size); break;
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped, unsigned Bypass>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processSamplesPrivate(const float* in, float* out, std::size_t size)
+{
+    // Load block-constant parameters and tank feedback once per block
+    const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+    const float wetGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::WetGain));
+    CycleCounter::Count probe = mProfiler_.start();
+    TankState tankState = loadTankState();
+    float dryGain = mDryGain_;
+    float wetGain = mWetGain_;
+
+    for(std::size_t i = 0; i < size; i++)
+    {
+        // Core processing is Mono->Stereo
+        float outWetL, outWetR;
+        processAudioPrivate<Topology, Ramped, Bypass>(in[i], tankState, outWetL, outWetR, probe);
+        advanceDelayNetwork(1);
+
+        // Dry/Wet -> Stereo to mono
+        if (Ramped)
+        {
+            dryGain += dryGainStep;
+            wetGain += wetGainStep;
+        }
+        float outWetMono = (outWetL + outWetR)/2.0f;
+        out[i] = in[i]*dryGain + outWetMono*wetGain;
+        probe = mProfiler_.lap(ProfileStage::OutputMix, probe);
+    }
+
+    // Store tank feedback for the next block
+    storeTankState(tankState);
+    skipModulation<Topology>(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processBlockPrivate(const float* inL, const float* inR, float* outL, float* outR, std::size_t size, unsigned bypass)
+{
+    if (mProcessMode_ == ProcessMode::StageMajor)
+    {
+        const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+        const float wetGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::WetGain));
+        CycleCounter::Count probe = mProfiler_.start();
+        float dryGain = mDryGain_;
+        float wetGain = mWetGain_;
+        while (size > 0)
+        {
+            std::size_t chunk = (size < kStageBlockSize) ? size : kStageBlockSize;
+
+            // Stereo->Mono. Core processing is Mono->Stereo
+            for(std::size_t i = 0; i < chunk; i++)
+                mStageInput_[i] = (inL[i] + inR[i])/2.0f;
+            processStagesPrivate<Topology, Ramped>(mStageInput_, mStageWetL_, mStageWetR_, chunk, bypass, probe);
+            advanceDelayNetwork(chunk);
+
+            // Dry/Wet
+            if (bypass & kBypassDry)
+            {
+                for(std::size_t i = 0; i < chunk; i++)
+                {
+                    outL[i] = mStageWetL_[i]*wetGain;
+                    outR[i] = mStageWetR_[i]*wetGain;
+                }
+            }
+            else
+            {
+                for(std::size_t i = 0; i < chunk; i++)
+                {
+                    if (Ramped)
+                    {
+                        dryGain += dryGainStep;
+                        wetGain += wetGainStep;
+                    }
+                    const float inputSampleL = inL[i];
+                    const float inputSampleR = inR[i];
+                    outL[i] = inputSampleL*dryGain + mStageWetL_[i]*wetGain;
+                    outR[i] = inputSampleR*dryGain + mStageWetR_[i]*wetGain;
+                }
+            }
+            probe = mProfiler_.lap(ProfileStage::OutputMix, probe);
+            inL += chunk;
+            inR += chunk;
+            outL += chunk;
+            outR += chunk;
+            size -= chunk;
+        }
+        return;
+    }
+
+    // Sample-major: one loop per set of bypassed stages (see the mono version)
+    switch (bypassVariant(Topology, Ramped, bypass))
+    {
+        case 0: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 0)>(inL, inR, outL, outR, size); break;
+        case 1: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 1)>(inL, inR, outL, outR, size); break;
+        case 2: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 2)>(inL, inR, outL, outR, size); break;
+        case 3: processSamplesPrivate<Topology, Ramped, bypassVariant(Topology, Ramped, 3)>(inL, inR, outL, outR, size); break;
+    }
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped, unsigned Bypass>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processSamplesPrivate(const float* inL, const float* inR, float* outL, float* outR, std::size_t size)
+{
+    // Load block-constant parameters and tank feedback once per block
+    const float dryGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::DryGain));
+    const float wetGainStep = mSmoothers_.getBlockStep(smoothedIndex(SmoothedParameter::WetGain));
+    CycleCounter::Count probe = mProfiler_.start();
+    TankState tankState = loadTankState();
+    float dryGain = mDryGain_;
+    float wetGain = mWetGain_;
+
+    for(std::size_t i = 0; i < size; i++)
+    {
+        // Read inputs first: in and out buffers may be the same memory
+        const float inputSampleL = inL[i];
+        const float inputSampleR = inR[i];
+
+        // Stereo->Mono. Core processing is Mono->Stereo
+        float inputSample = (inputSampleL + inputSampleR)/2.0f;
+        float outWetL, outWetR;
+        processAudioPrivate<Topology, Ramped, Bypass>(inputSample, tankState, outWetL, outWetR, probe);
+        advanceDelayNetwork(1);
+
+        // Dry/Wet
+        if (Ramped)
+        {
+            dryGain += dryGainStep;
+            wetGain += wetGainStep;
+        }
+        outL[i] = inputSampleL*dryGain + outWetL*wetGain;
+        outR[i] = inputSampleR*dryGain + outWetR*wetGain;
+        probe = mProfiler_.lap(ProfileStage::OutputMix, probe);
+    }
+
+    // Store tank feedback for the next block
+    storeTankState(tankState);
+    skipModulation<Topology>(size);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped, unsigned Bypass>
+inline void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processAudioPrivate(float inputSample, TankState& tankState, float& outWetL, float& outWetR, CycleCounter::Count& probe)
 {
     /* ------------ Core processing stereo function ------------ */
+    // NOTE: 'Topology' and 'Bypass' are template parameters: the topology and bypass tests
+    // below are resolved at compile time, each specialisation only contains its own tank.
 
     /* ---------------------------------------------------------------------- */
     /*                              INPUT SECTION                             */
     /* ---------------------------------------------------------------------- */
-    // Pre-delay (pre-delay time can be user controlled)
-    mPredelayOut_ = mPredelay_.processAudio(inputSample);
-    
-    // Input lowpass filter
-    mInputLowpassOut_ = mInputLowpass_.processAudioLP(mPredelayOut_);
-    
-    // Input highpass filter
-    mInputHighpassOut_ = mInputHighpass_.processAudioHP(mInputLowpassOut_);
-    
+    float inputHighpassOut = inputSample;
+    if (!(Bypass & kBypassInputFilters))
+    {
+        // Pre-delay (pre-delay time can be user controlled)
+        float predelayOut = mPredelay_.processAudio(inputSample);
+
+        // Input lowpass filter
+        float inputLowpassOut = mInputLowpass_.processAudioLP(predelayOut);
+
+        // Input highpass filter
+        inputHighpassOut = mInputHighpass_.processAudioHP(inputLowpassOut);
+        probe = mProfiler_.lap(ProfileStage::InputFilters, probe);
+    }
+
     // Input Allpass diffusers
-    mInputAllpass1Out_ = mInputAllpass1_.processAudio(mInputHighpassOut_);
-    mInputAllpass2Out_ = mInputAllpass2_.processAudio(mInputAllpass1Out_);
-    mInputAllpass3Out_ = mInputAllpass3_.processAudio(mInputAllpass2Out_);
-    mInputAllPass4Out_ = mInputAllpass4_.processAudio(mInputAllpass3Out_);
-    
+    float inputAllpass1Out = mInputAllpass1_.processAudio(inputHighpassOut);
+    float inputAllpass2Out = mInputAllpass2_.processAudio(inputAllpass1Out);
+    float inputAllpass3Out = mInputAllpass3_.processAudio(inputAllpass2Out);
+    float inputAllpass4Out = mInputAllpass4_.processAudio(inputAllpass3Out);
+    probe = mProfiler_.lap(ProfileStage::InputDiffusers, probe);
+
     /* ---------------------------------------------------------------------- */
     /*                              TANK SECTION                              */
     /* ---------------------------------------------------------------------- */
+    if (Ramped) tankState.decay += tankState.decayStep;
+    const float tankDecay = tankState.decay;
+
     // tank input accumulator summed with input diffusers' output
-    mTankInput1_ = mInputAllPass4Out_ + mTankAccumulator2_;
-    mTankInput2_ = mInputAllPass4Out_ + mTankAccumulator1_;
-    
-    // Modulated tank all-passes
-    mModAllpass1Out_ = mModAllpass1_.processAudio(mTankInput1_);
-    mModAllpass2Out_ = mModAllpass2_.processAudio(mTankInput2_);
-    
+    float tankInput1 = inputAllpass4Out + tankState.accumulator2;
+    float tankInput2 = inputAllpass4Out + tankState.accumulator1;
+
+    // Modulated tank all-passes (the plain tank has no modulation depth: LFOs skipped,
+    // their phase is moved on once per block by skipModulation())
+    float modulation[ModulationLfos::kNumOutputs] = {};
+    if (Topology != TankTopology::Plain) mModulation_.processSample(modulation);
+    float modAllpass1Out = mModAllpass1_.processAudio(tankInput1, modulation[ModulationLfos::sineOutput(0)]);
+    float modAllpass2Out = mModAllpass2_.processAudio(tankInput2, modulation[ModulationLfos::sineOutput(1)]);
+    probe = mProfiler_.lap(ProfileStage::ModulatedAllpasses, probe);
+
     // Delay lines (1 and 3)
-    mTankDelay1Out_ = mTankDelay1_.processAudio(mModAllpass1Out_);
-    mTankDelay3Out_ = mTankDelay3_.processAudio(mModAllpass2Out_);
-    
+    float tankDelay1Out = mTankDelay1_.processAudio(modAllpass1Out);
+    float tankDelay3Out = mTankDelay3_.processAudio(modAllpass2Out);
+    probe = mProfiler_.lap(ProfileStage::TankDelays, probe);
+
     // Saturation
-    // 2 different saturation curves, one for each leg of the tank
-    mSaturator1Out_ = mSaturator_.processAudioAtan(mTankDelay1Out_);
-    mSaturator2Out_ = mSaturator_.processAudioTanh(mTankDelay3Out_);
-    
+    // 2 different saturation curves, one for each leg of the tank (oversampled if enabled)
+    const FastSaturator<>& saturator = mSaturator_;
+    float saturator1Out = mSaturatorOversampler1_.processAudio(tankDelay1Out, [&saturator](float x) { return saturator.processAudioAtan(x); });
+    float saturator2Out = mSaturatorOversampler2_.processAudio(tankDelay3Out, [&saturator](float x) { return saturator.processAudioTanh(x); });
+    probe = mProfiler_.lap(ProfileStage::Saturators, probe);
+
     // Tank Lowpass Filtering (Damping)
-    mTankLowpass1Out_ = mTankLowpass1_.processAudioLP(mSaturator1Out_);
-    mTankLowpass2Out_ = mTankLowpass2_.processAudioLP(mSaturator2Out_);
-    
+    float tankLowpass1Out = mTankLowpass1_.processAudioLP(saturator1Out);
+    float tankLowpass2Out = mTankLowpass2_.processAudioLP(saturator2Out);
+
     // Tank HighPass
-    mTankHighpass1Out_ = mTankHighpass1_.processAudioHP(mTankLowpass1Out_);
-    mTankHighpass2Out_ = mTankHighpass2_.processAudioHP(mTankLowpass2Out_);
-    
+    float tankHighpass1Out = tankLowpass1Out;
+    float tankHighpass2Out = tankLowpass2Out;
+    if (!(Bypass & kBypassTankHighpass))
+    {
+        tankHighpass1Out = mTankHighpass1_.processAudioHP(tankLowpass1Out);
+        tankHighpass2Out = mTankHighpass2_.processAudioHP(tankLowpass2Out);
+    }
+    probe = mProfiler_.lap(ProfileStage::Damping, probe);
+
     // Tank AllPass filters
-    mTankAllpass5Out_ = mTankAllpass5_.processAudio(mTankHighpass1Out_);
-    mTankAllpass6Out_ = mTankAllpass6_.processAudio(mTankHighpass2Out_);
-    
+    float tankAllpass5Out = mTankAllpass5_.processAudio(tankHighpass1Out);
+    float tankAllpass6Out = mTankAllpass6_.processAudio(tankHighpass2Out);
+
     // Add decay control between the allpass filters and the last delay lines
-    mTankAllpass5Out_ = mTankAllpass5Out_*mTankDecay_;
-    mTankAllpass6Out_ = mTankAllpass6Out_*mTankDecay_;
-    
+    tankAllpass5Out = tankAllpass5Out*tankDecay;
+    tankAllpass6Out = tankAllpass6Out*tankDecay;
+
     // Delay lines (2 and 4)
-    mTankDelay2Out_ = mTankDelay2_.processAudio(mTankAllpass5Out_);
-    mTankDelay4Out_ = mTankDelay4_.processAudio(mTankAllpass6Out_);
-    
-    // If Smooth == on allpass 7 - 10 are included
-    if (mIsSmoothed_ == 1)
+    float tankDelay2Out = mTankDelay2_.processAudio(tankAllpass5Out);
+    float tankDelay4Out = mTankDelay4_.processAudio(tankAllpass6Out);
+    probe = mProfiler_.lap(ProfileStage::TankDelays, probe);
+
+    // If Smooth == off then allpasses 7 - 10 are bypassed
+    if (Topology == TankTopology::Plain)
     {
-        // Added Allpasses 7 - 10
-        mTankAllpass7Out_ = mTankAllpass7_.processAudio(mTankDelay2Out_);
-        mTankAllpass8Out_ = mTankAllpass8_.processAudio(mTankDelay4Out_);
-        mTankAllpass9Out_ = mTankAllpass9_.processAudio(mTankAllpass7Out_);
-        mTankAllpass10Out_ = mTankAllpass10_.processAudio(mTankAllpass8Out_);
-        
         // Compute the accumulators as the outputs from the last tank nodes scaled by decay control
-        mTankAccumulator1_ = mTankDecay_*(mTankAllpass9Out_);
-        mTankAccumulator2_ = mTankDecay_*(mTankAllpass10Out_);
-        
+        tankState.accumulator1 = tankDecay*(tankDelay2Out);
+        tankState.accumulator2 = tankDecay*(tankDelay4Out);
+
         // Simplified wet output computation compared to dattorro's
-        mOutWetL_ = 0.6f*(mTankDelay3Out_ - mTankAllpass5Out_ + mTankDelay2Out_ - mTankAllpass8Out_ + mTankAllpass10Out_);
-        mOutWetR_ = 0.6f*(mTankDelay1Out_ - mTankAllpass6Out_ + mTankDelay4Out_ - mTankAllpass7Out_ + mTankAllpass9Out_);   
+        outWetL = 0.7f*(tankDelay3Out - tankAllpass5Out + tankDelay2Out);
+        outWetR = 0.7f*(tankDelay1Out - tankAllpass6Out + tankDelay4Out);
+        return;
     }
-    
-    // If Smooth == off then allpasses 7 - 10 are bypassed
-    if (mIsSmoothed_ == 0)
+
+    // If Smooth == on allpass 7 - 10 are included
+    float tankAllpass7Out = mTankAllpass7_.processAudio(tankDelay2Out);
+    float tankAllpass8Out = mTankAllpass8_.processAudio(tankDelay4Out);
+    float tankAllpass9Out = mTankAllpass9_.processAudio(tankAllpass7Out);
+    float tankAllpass10Out = mTankAllpass10_.processAudio(tankAllpass8Out);
+    probe = mProfiler_.lap(ProfileStage::SmoothAllpasses, probe);
+
+    if (Topology == TankTopology::Smoothed)
     {
         // Compute the accumulators as the outputs from the last tank nodes scaled by decay control
-        mTankAccumulator1_ = mTankDecay_*(mTankDelay2Out_);
-        mTankAccumulator2_ = mTankDecay_*(mTankDelay4Out_);
-        
+        tankState.accumulator1 = tankDecay*(tankAllpass9Out);
+        tankState.accumulator2 = tankDecay*(tankAllpass10Out);
+
         // Simplified wet output computation compared to dattorro's
-        mOutWetL_ = 0.7f*(mTankDelay3Out_ - mTankAllpass5Out_ + mTankDelay2Out_);
-        mOutWetR_ = 0.7f*(mTankDelay1Out_ - mTankAllpass6Out_ + mTankDelay4Out_);
+        outWetL = 0.6f*(tankDelay3Out - tankAllpass5Out + tankDelay2Out - tankAllpass8Out + tankAllpass10Out);
+        outWetR = 0.6f*(tankDelay1Out - tankAllpass6Out + tankDelay4Out - tankAllpass7Out + tankAllpass9Out);
+        return;
+    }
+
+    // Crossfade: ramp between the plain and the smoothed tank outputs and feedback
+    float smoothMix = tankState.smoothMix + tankState.smoothMixStep;
+    if (smoothMix > 1.0f) smoothMix = 1.0f;
+    if (smoothMix < 0.0f) smoothMix = 0.0f;
+    tankState.smoothMix = smoothMix;
+
+    tankState.accumulator1 = tankDecay*(tankDelay2Out + smoothMix*(tankAllpass9Out - tankDelay2Out));
+    tankState.accumulator2 = tankDecay*(tankDelay4Out + smoothMix*(tankAllpass10Out - tankDelay4Out));
+
+    float outWetPlainL = 0.7f*(tankDelay3Out - tankAllpass5Out + tankDelay2Out);
+    float outWetPlainR = 0.7f*(tankDelay1Out - tankAllpass6Out + tankDelay4Out);
+    float outWetSmoothL = 0.6f*(tankDelay3Out - tankAllpass5Out + tankDelay2Out - tankAllpass8Out + tankAllpass10Out);
+    float outWetSmoothR = 0.6f*(tankDelay1Out - tankAllpass6Out + tankDelay4Out - tankAllpass7Out + tankAllpass9Out);
+    outWetL = outWetPlainL + smoothMix*(outWetSmoothL - outWetPlainL);
+    outWetR = outWetPlainR + smoothMix*(outWetSmoothR - outWetPlainR);
+}
+
+template<std::size_t MaxPredelaySamples, int SampleRate, DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+template<typename ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::TankTopology Topology, bool Ramped>
+void ReverbZ<MaxPredelaySamples, SampleRate, Storage, TankFormat, ModInterpolation>::processStagesPrivate(const float* input, float* outWetL, float* outWetR, std::size_t size, unsigned bypass, CycleCounter::Count& probe)
+{
+    /* ------------ Core processing, one stage at a time over the chunk ------------ */
+    // The only feedback is through tank delay lines 2 and 4 (plus the accumulators).
+    // With size <= their delay, the outputs of those lines for the whole chunk are already
+    // in their buffers, so the loop can be cut there and every other stage runs in order.
+    TankState tankState = loadTankState();
+
+    /* ---------------------------------------------------------------------- */
+    /*                              INPUT SECTION                             */
+    /* ---------------------------------------------------------------------- */
+    // Neutral stages (see bypassVariant()) are checked once per chunk
+    float* diffused = mStageDiffused_;
+    if (bypass & kBypassInputFilters)
+    {
+        mInputAllpass1_.processAudio(input, diffused, size);
+    }
+    else
+    {
+        mPredelay_.processAudio(input, diffused, size);
+        for(std::size_t i = 0; i < size; i++) diffused[i] = mInputLowpass_.processAudioLP(diffused[i]);
+        for(std::size_t i = 0; i < size; i++) diffused[i] = mInputHighpass_.processAudioHP(diffused[i]);
+        probe = mProfiler_.lap(ProfileStage::InputFilters, probe);
+        mInputAllpass1_.processAudio(diffused, diffused, size);
+    }
+    mInputAllpass2_.processAudio(diffused, diffused, size);
+    mInputAllpass3_.processAudio(diffused, diffused, size);
+    mInputAllpass4_.processAudio(diffused, diffused, size);
+    probe = mProfiler_.lap(ProfileStage::InputDiffusers, probe);
+
+    /* ---------------------------------------------------------------------- */
+    /*                   TANK OUTPUT LEGS (read ahead)                        */
+    /* ---------------------------------------------------------------------- */
+    // Delay lines (2 and 4): outputs of this chunk were written at least one chunk ago
+    mTankDelay2_.read(mStageDelay2_, size);
+    mTankDelay4_.read(mStageDelay4_, size);
+    probe = mProfiler_.lap(ProfileStage::TankDelays, probe);
+
+    if (Topology != TankTopology::Plain)
+    {
+        // Added Allpasses 7 - 10
+        mTankAllpass7_.processAudio(mStageDelay2_, mStageAllpass7_, size);
+        mTankAllpass8_.processAudio(mStageDelay4_, mStageAllpass8_, size);
+        mTankAllpass9_.processAudio(mStageAllpass7_, mStageAllpass9_, size);
+        mTankAllpass10_.processAudio(mStageAllpass8_, mStageAllpass10_, size);
+        probe = mProfiler_.lap(ProfileStage::SmoothAllpasses, probe);
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /*                              TANK SECTION                              */
+    /* ---------------------------------------------------------------------- */
+    // tank input accumulator summed with input diffusers' output.
+    // Accumulators are one sample behind: the only sample-serial loop in the chunk
+    // (and the decay ramp, if any, kept for the decay stage below).
+    for(std::size_t i = 0; i < size; i++)
+    {
+        if (Ramped)
+        {
+            tankState.decay += tankState.decayStep;
+            mStageDecay_[i] = tankState.decay;
+        }
+        const float tankDecay = tankState.decay;
+        mStageTank1_[i] = diffused[i] + tankState.accumulator2;
+        mStageTank2_[i] = diffused[i] + tankState.accumulator1;
+        if (Topology == TankTopology::Plain)
+        {
+            tankState.accumulator1 = tankDecay*mStageDelay2_[i];
+            tankState.accumulator2 = tankDecay*mStageDelay4_[i];
+        }
+        else if (Topology == TankTopology::Smoothed)
+        {
+            tankState.accumulator1 = tankDecay*mStageAllpass9_[i];
+            tankState.accumulator2 = tankDecay*mStageAllpass10_[i];
+        }
+        else
+        {
+            float smoothMix = tankState.smoothMix + tankState.smoothMixStep;
+            if (smoothMix > 1.0f) smoothMix = 1.0f;
+            if (smoothMix < 0.0f) smoothMix = 0.0f;
+            tankState.smoothMix = smoothMix;
+            mStageSmoothMix_[i] = smoothMix;
+            tankState.accumulator1 = tankDecay*(mStageDelay2_[i] + smoothMix*(mStageAllpass9_[i] - mStageDelay2_[i]));
+            tankState.accumulator2 = tankDecay*(mStageDelay4_[i] + smoothMix*(mStageAllpass10_[i] - mStageDelay4_[i]));
+        }
+    }
+    storeTankState(tankState);
+
+    // Modulated tank all-passes (LFO cosines unused; no depth in the plain tank)
+    if (Topology == TankTopology::Plain)
+    {
+        skipModulation<Topology>(size);
+        for(std::size_t i = 0; i < size; i++) mStageTank1_[i] = mModAllpass1_.processAudio(mStageTank1_[i], 0.0f);
+        for(std::size_t i = 0; i < size; i++) mStageTank2_[i] = mModAllpass2_.processAudio(mStageTank2_[i], 0.0f);
+    }
+    else
+    {
+        float* modulation[ModulationLfos::kNumOutputs] = {};
+        modulation[ModulationLfos::sineOutput(0)] = mStageModulation1_;
+        modulation[ModulationLfos::sineOutput(1)] = mStageModulation2_;
+        mModulation_.processBlock(modulation, size);
+        mModAllpass1_.processAudio(mStageTank1_, mStageTank1_, mStageModulation1_, size);
+        mModAllpass2_.processAudio(mStageTank2_, mStageTank2_, mStageModulation2_, size);
+    }
+    probe = mProfiler_.lap(ProfileStage::ModulatedAllpasses, probe);
+
+    // Delay lines (1 and 3)
+    mTankDelay1_.processAudio(mStageTank1_, mStageDelay1_, size);
+    mTankDelay3_.processAudio(mStageTank2_, mStageDelay3_, size);
+    probe = mProfiler_.lap(ProfileStage::TankDelays, probe);
+
+    // Saturation (block curve kernels, or the oversampled nodes)
+    if (mSaturatorOversampler1_.getFactor() == 1)
+    {
+        mSaturator_.processAudioAtan(mStageDelay1_, mStageTank1_, size);
+        mSaturator_.processAudioTanh(mStageDelay3_, mStageTank2_, size);
+    }
+    else
+    {
+        const FastSaturator<>& saturator = mSaturator_;
+        mSaturatorOversampler1_.processAudio(mStageDelay1_, mStageTank1_, size, [&saturator](float x) { return saturator.processAudioAtan(x); });
+        mSaturatorOversampler2_.processAudio(mStageDelay3_, mStageTank2_, size, [&saturator](float x) { return saturator.processAudioTanh(x); });
+    }
+    probe = mProfiler_.lap(ProfileStage::Saturators, probe);
+
+    // Tank Lowpass Filtering (Damping)
+    for(std::size_t i = 0; i < size; i++) mStageTank1_[i] = mTankLowpass1_.processAudioLP(mStageTank1_[i]);
+    for(std::size_t i = 0; i < size; i++) mStageTank2_[i] = mTankLowpass2_.processAudioLP(mStageTank2_[i]);
+
+    // Tank HighPass
+    if (!(bypass & kBypassTankHighpass))
+    {
+        for(std::size_t i = 0; i < size; i++) mStageTank1_[i] = mTankHighpass1_.processAudioHP(mStageTank1_[i]);
+        for(std::size_t i = 0; i < size; i++) mStageTank2_[i] = mTankHighpass2_.processAudioHP(mStageTank2_[i]);
+    }
+    probe = mProfiler_.lap(ProfileStage::Damping, probe);
+
+    // Tank AllPass filters
+    mTankAllpass5_.processAudio(mStageTank1_, mStageTank1_, size);
+    mTankAllpass6_.processAudio(mStageTank2_, mStageTank2_, size);
+
+    // Add decay control between the allpass filters and the last delay lines
+    if (Ramped)
+    {
+        for(std::size_t i = 0; i < size; i++) mStageTank1_[i] *= mStageDecay_[i];
+        for(std::size_t i = 0; i < size; i++) mStageTank2_[i] *= mStageDecay_[i];
+    }
+    else
+    {
+        const float tankDecay = tankState.decay;
+        for(std::size_t i = 0; i < size; i++) mStageTank1_[i] *= tankDecay;
+        for(std::size_t i = 0; i < size; i++) mStageTank2_[i] *= tankDecay;
+    }
+
+    // Delay lines (2 and 4): close the loop
+    mTankDelay2_.write(mStageTank1_, size);
+    mTankDelay4_.write(mStageTank2_, size);
+    probe = mProfiler_.lap(ProfileStage::TankDelays, probe);
+
+    /* ---------------------------------------------------------------------- */
+    /*                               OUTPUT TAPS                              */
+    /* ---------------------------------------------------------------------- */
+    // Simplified wet output computation compared to dattorro's
+    if (Topology == TankTopology::Plain)
+    {
+        for(std::size_t i = 0; i < size; i++)
+        {
+            outWetL[i] = 0.7f*(mStageDelay3_[i] - mStageTank1_[i] + mStageDelay2_[i]);
+            outWetR[i] = 0.7f*(mStageDelay1_[i] - mStageTank2_[i] + mStageDelay4_[i]);
+        }
+    }
+    else if (Topology == TankTopology::Smoothed)
+    {
+        for(std::size_t i = 0; i < size; i++)
+        {
+            outWetL[i] = 0.6f*(mStageDelay3_[i] - mStageTank1_[i] + mStageDelay2_[i] - mStageAllpass8_[i] + mStageAllpass10_[i]);
+            outWetR[i] = 0.6f*(mStageDelay1_[i] - mStageTank2_[i] + mStageDelay4_[i] - mStageAllpass7_[i] + mStageAllpass9_[i]);
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i < size; i++)
+        {
+            float outWetPlainL = 0.7f*(mStageDelay3_[i] - mStageTank1_[i] + mStageDelay2_[i]);
+            float outWetPlainR = 0.7f*(mStageDelay1_[i] - mStageTank2_[i] + mStageDelay4_[i]);
+            float outWetSmoothL = 0.6f*(mStageDelay3_[i] - mStageTank1_[i] + mStageDelay2_[i] - mStageAllpass8_[i] + mStageAllpass10_[i]);
+            float outWetSmoothR = 0.6f*(mStageDelay1_[i] - mStageTank2_[i] + mStageDelay4_[i] - mStageAllpass7_[i] + mStageAllpass9_[i]);
+            outWetL[i] = outWetPlainL + mStageSmoothMix_[i]*(outWetSmoothL - outWetPlainL);
+            outWetR[i] = outWetPlainR + mStageSmoothMix_[i]*(outWetSmoothR - outWetPlainR);
+        }
     }
 }
 
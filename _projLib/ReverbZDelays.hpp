@@ -0,0 +1,114 @@
+/** -------------------------------------------------------------------------
+    ReverbZDelays.hpp - Compile-time delay table of the ReverbZ network.
+
+    Dattorro's delay lengths, given at his original 29761 Hz, scaled to the
+    project sampling frequency and rounded to the nearest sample at compile
+    time. ReverbZ sizes the buffer of each line from them.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef ReverbZDelays_hpp
+#define ReverbZDelays_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+constexpr int kFsDattorro = 29761;                  // Dattorro's original sampling frequency
+
+// Scale a delay length from Dattorro's sampling frequency, rounded to the nearest sample
+constexpr int scaleDattorroDelay(int dattorroSamples, int sampleRate)
+{
+    return static_cast<int>((2LL*dattorroSamples*sampleRate + kFsDattorro)/(2LL*kFsDattorro));
+}
+
+constexpr int minDelay(int a, int b) { return (a < b) ? a : b; }
+constexpr int maxDelay(int a, int b) { return (a > b) ? a : b; }
+
+// Buffer length of a line: longest delay + 1 + headroom, rounded up to 8 samples
+// (regions packed in one delay memory block stay 32-byte aligned)
+constexpr std::size_t delayLineCapacity(std::size_t maxDelaySamples, std::size_t headroom)
+{
+    return (maxDelaySamples + 1 + headroom + 7) & ~static_cast<std::size_t>(7);
+}
+
+template<int SampleRate>
+struct ReverbZDelays {
+    static_assert(SampleRate > 0, "ReverbZDelays: sample rate must be positive");
+
+    // Input Allpasses
+    static constexpr int kInputAllpass1 = scaleDattorroDelay(142, SampleRate);
+    static constexpr int kInputAllpass2 = scaleDattorroDelay(107, SampleRate);
+    static constexpr int kInputAllpass3 = scaleDattorroDelay(379, SampleRate);
+    static constexpr int kInputAllpass4 = scaleDattorroDelay(277, SampleRate);
+    // Tank modulated allpasses
+    static constexpr int kModAllpass1 = scaleDattorroDelay(672, SampleRate);
+    static constexpr int kModAllpass2 = scaleDattorroDelay(908, SampleRate);
+    // Tank delay lines
+    static constexpr int kTankDelay1 = scaleDattorroDelay(4453, SampleRate);
+    static constexpr int kTankDelay2 = scaleDattorroDelay(4217, SampleRate);
+    static constexpr int kTankDelay3 = scaleDattorroDelay(3720, SampleRate);
+    static constexpr int kTankDelay4 = scaleDattorroDelay(3163, SampleRate);
+    // Tank non-modulated allpasses
+    static constexpr int kTankAllpass5 = scaleDattorroDelay(1800, SampleRate);
+    static constexpr int kTankAllpass6 = scaleDattorroDelay(2656, SampleRate);
+    // (delay times for allpass 7-10 are prime numbers)
+    static constexpr int kTankAllpass7 = scaleDattorroDelay(1511, SampleRate);
+    static constexpr int kTankAllpass8 = scaleDattorroDelay(2003, SampleRate);
+    static constexpr int kTankAllpass9 = scaleDattorroDelay(1709, SampleRate);
+    static constexpr int kTankAllpass10 = scaleDattorroDelay(2411, SampleRate);
+
+    // Shortest delay closing the tank feedback loop (tank delay lines 2 and 4)
+    static constexpr int kShortestFeedbackDelay = minDelay(kTankDelay2, kTankDelay4);
+    // Shortest fixed (non-modulated) line
+    static constexpr int kShortestFixedDelay =
+        minDelay(minDelay(minDelay(kInputAllpass1, kInputAllpass2), minDelay(kInputAllpass3, kInputAllpass4)),
+                 minDelay(minDelay(minDelay(kTankDelay1, kTankDelay3), kShortestFeedbackDelay),
+                          minDelay(minDelay(minDelay(kTankAllpass5, kTankAllpass6), minDelay(kTankAllpass7, kTankAllpass8)),
+                                   minDelay(kTankAllpass9, kTankAllpass10))));
+    // Longest smooth tank allpass (7 - 10)
+    static constexpr int kLongestSmoothAllpass = maxDelay(maxDelay(kTankAllpass7, kTankAllpass8), maxDelay(kTankAllpass9, kTankAllpass10));
+    // Input diffusers in series (input allpasses 1 - 4)
+    static constexpr int kInputDiffusion = kInputAllpass1 + kInputAllpass2 + kInputAllpass3 + kInputAllpass4;
+    // One trip around the whole tank (both legs, allpasses 7 - 10 included), without modulation
+    static constexpr int kTankLoop = kModAllpass1 + kTankDelay1 + kTankAllpass5 + kTankDelay2 +
+                                     kModAllpass2 + kTankDelay3 + kTankAllpass6 + kTankDelay4 +
+                                     kTankAllpass7 + kTankAllpass8 + kTankAllpass9 + kTankAllpass10;
+    // Longest line (the modulated allpasses are given their modulation headroom by ReverbZ)
+    static constexpr int kLongestFixedDelay =
+        maxDelay(maxDelay(maxDelay(kInputAllpass3, kInputAllpass4), maxDelay(kTankDelay1, kTankDelay2)),
+                 maxDelay(maxDelay(kTankDelay3, kTankDelay4), maxDelay(maxDelay(kTankAllpass5, kTankAllpass6), kLongestSmoothAllpass)));
+};
+
+/* ------------------------ Static member definitions ----------------------- */
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kInputAllpass1;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kInputAllpass2;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kInputAllpass3;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kInputAllpass4;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kModAllpass1;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kModAllpass2;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankDelay1;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankDelay2;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankDelay3;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankDelay4;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass5;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass6;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass7;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass8;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass9;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankAllpass10;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kShortestFeedbackDelay;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kShortestFixedDelay;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kLongestSmoothAllpass;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kInputDiffusion;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kTankLoop;
+template<int SampleRate> constexpr int ReverbZDelays<SampleRate>::kLongestFixedDelay;
+
+}   // namespace projLib
+
+#endif /* ReverbZDelays_hpp */
@@ -0,0 +1,160 @@
+/** -------------------------------------------------------------------------
+    SampleFormat.hpp - Sample formats of the delay line storage.
+    Float32Format, Float16Format and Int16Format.
+
+    A format is the storage type of a ring buffer sample plus its conversion
+    from/to float, per sample and per block. The ring buffers store
+    Format::Type and convert on every read and write, so a line in a 16-bit
+    format takes half the memory (and half the memory bandwidth) of a float
+    line. The processing itself stays in float.
+
+    - Float32Format: plain float, no conversion (block copies are memcpy)
+    - Float16Format: IEEE half precision, 11-bit mantissa at any level.
+      Hardware conversion (__fp16) when the target supports it, e.g.
+      Cortex-M7 with -mfp16-format=ieee, bit manipulation otherwise.
+    - Int16Format: fixed point, kFullScale maps to 32767. 15 bits over the
+      whole range: finer than float16 near full scale, but quiet signals
+      (reverb tails) lose resolution and the tail is cut short once it
+      falls to the quantisation step.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef SampleFormat_hpp
+#define SampleFormat_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace projLib {
+
+// Floats of memory taking 'samples' samples of a format (rounded up)
+template<typename Format>
+constexpr std::size_t sampleStorageFloats(std::size_t samples)
+{
+    return (samples*sizeof(typename Format::Type) + sizeof(float) - 1)/sizeof(float);
+}
+
+/* ------------------------------ Float32Format ----------------------------- */
+struct Float32Format {
+    using Type = float;
+
+    static float decode(Type sample) { return sample; }
+    static Type encode(float sample) { return sample; }
+    static void decode(const Type* input, float* output, std::size_t size) { memcpy(output, input, size*sizeof(float)); }
+    static void encode(const float* input, Type* output, std::size_t size) { memcpy(output, input, size*sizeof(float)); }
+};
+
+/* ------------------------------ Float16Format ----------------------------- */
+struct Float16Format {
+#if defined(__ARM_FP16_FORMAT_IEEE)
+    using Type = __fp16;
+
+    static float decode(Type sample) { return static_cast<float>(sample); }
+    static Type encode(float sample) { return static_cast<Type>(sample); }
+#else
+    using Type = std::uint16_t;
+
+    static float decode(Type sample);
+    static Type encode(float sample);
+#endif
+
+    static void decode(const Type* input, float* output, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = decode(input[i]);
+    }
+    static void encode(const float* input, Type* output, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = encode(input[i]);
+    }
+};
+
+/* ------------------------------- Int16Format ------------------------------ */
+struct Int16Format {
+    using Type = std::int16_t;
+
+    static constexpr float kFullScale = 4.0f;           // headroom over the +/-1 audio range (+12 dB)
+    static constexpr float kEncodeGain = 32767.0f/kFullScale;
+    static constexpr float kDecodeGain = kFullScale/32767.0f;
+
+    static float decode(Type sample) { return static_cast<float>(sample)*kDecodeGain; }
+    static Type encode(float sample)
+    {
+        // Saturate (no wrap-around in the feedback loop) and truncate toward zero:
+        // rounding to nearest lets a decaying loop settle on a +/-1 step limit cycle
+        float scaled = sample*kEncodeGain;
+        if (scaled > 32767.0f) scaled = 32767.0f;
+        if (scaled < -32767.0f) scaled = -32767.0f;
+        return static_cast<Type>(scaled);
+    }
+    static void decode(const Type* input, float* output, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = decode(input[i]);
+    }
+    static void encode(const float* input, Type* output, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++) output[i] = encode(input[i]);
+    }
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+#if !defined(__ARM_FP16_FORMAT_IEEE)
+inline float Float16Format::decode(Type sample)
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(sample & 0x8000u) << 16;
+    const std::uint32_t exponent = (sample >> 10) & 0x1fu;
+    const std::uint32_t mantissa = sample & 0x3ffu;
+
+    if (exponent == 0)
+    {
+        // Zero and subnormals: mantissa * 2^-24
+        const float value = static_cast<float>(mantissa)*5.9604645e-8f;
+        return sign ? -value : value;
+    }
+
+    // Normal numbers (encode() never produces infinities or NaNs)
+    const std::uint32_t bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline Float16Format::Type Float16Format::encode(float sample)
+{
+    std::uint32_t bits;
+    memcpy(&bits, &sample, sizeof(bits));
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    const std::int32_t exponent = static_cast<std::int32_t>((bits >> 23) & 0xffu) - 112;
+    std::uint32_t mantissa = bits & 0x7fffffu;
+
+    // Overflow (and infinities/NaNs) saturate to the largest half, +/-65504
+    if (exponent >= 31) return static_cast<Type>(sign | 0x7bffu);
+
+    if (exponent <= 0)
+    {
+        // Subnormal half (or zero): shift the implicit bit in, round to nearest
+        if (exponent < -10) return static_cast<Type>(sign);
+        mantissa |= 0x800000u;
+        const std::uint32_t shift = static_cast<std::uint32_t>(14 - exponent);
+        const std::uint32_t half = (mantissa + (1u << (shift - 1))) >> shift;
+        return static_cast<Type>(sign | half);
+    }
+
+    // Normal half, round to nearest (a mantissa carry moves into the exponent)
+    std::uint32_t half = (static_cast<std::uint32_t>(exponent) << 10) | (mantissa >> 13);
+    half += (mantissa >> 12) & 1u;
+    if (half > 0x7bffu) half = 0x7bffu;
+    return static_cast<Type>(sign | half);
+}
+#endif
+
+}   // namespace projLib
+
+#endif /* SampleFormat_hpp */
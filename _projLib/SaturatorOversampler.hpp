@@ -0,0 +1,140 @@
+/** -------------------------------------------------------------------------
+    SaturatorOversampler.hpp - Header file for SaturatorOversampler class.
+    2x/4x oversampling around one saturation node.
+
+    Upsamples the node input, runs the curve at the high rate and brings the
+    result back down, so the harmonics the curve generates above Nyquist are
+    filtered instead of aliasing back into the band. Only the node is
+    oversampled: the rest of the graph keeps running at the base rate.
+
+        2x: steep halfband (8 coefs) up and down
+        4x: steep halfband, then relaxed halfband (4 coefs) for 2x -> 4x
+
+    The curve is any callable float(float) (e.g. a lambda on a
+    FastSaturator), inlined in the oversampled loops. Factor 1 calls the
+    curve directly.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef SaturatorOversampler_hpp
+#define SaturatorOversampler_hpp
+
+#include <cstddef>
+#include "PolyphaseHalfband.hpp"
+
+namespace projLib {
+
+class SaturatorOversampler {
+    public:
+        SaturatorOversampler();
+        ~SaturatorOversampler();
+
+        // 1, 2 or 4 (anything else is 1). Filter states are cleared when the factor changes.
+        void setFactor(int factor);
+        int getFactor() const { return mFactor_; }
+        void clear();                               // filter states back to silence
+
+        // Per-sample processing
+        template<typename Curve>
+        float processAudio(float inputSample, Curve curve);
+        // Block processing ('input' and 'output' may be the same memory)
+        template<typename Curve>
+        void processAudio(const float* input, float* output, std::size_t size, Curve curve);
+
+    private:
+        template<typename Curve>
+        inline float process2x(float inputSample, Curve& curve);
+        template<typename Curve>
+        inline float process4x(float inputSample, Curve& curve);
+
+        int mFactor_;
+        HalfbandUpsampler2x<kHalfbandSteepCoefs> mUpsampler1_;          // base rate -> 2x
+        HalfbandUpsampler2x<kHalfbandRelaxedCoefs> mUpsampler2_;        // 2x -> 4x
+        HalfbandDownsampler2x<kHalfbandRelaxedCoefs> mDownsampler2_;    // 4x -> 2x
+        HalfbandDownsampler2x<kHalfbandSteepCoefs> mDownsampler1_;      // 2x -> base rate
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline SaturatorOversampler::SaturatorOversampler()
+:
+mFactor_(1)
+{
+    mUpsampler1_.init(halfbandSteep());
+    mUpsampler2_.init(halfbandRelaxed());
+    mDownsampler2_.init(halfbandRelaxed());
+    mDownsampler1_.init(halfbandSteep());
+}
+
+inline SaturatorOversampler::~SaturatorOversampler(){}
+
+inline void SaturatorOversampler::setFactor(int factor)
+{
+    if (factor != 2 && factor != 4) factor = 1;
+    if (factor == mFactor_) return;
+
+    // Start the filters from silence rather than from stale history
+    mFactor_ = factor;
+    clear();
+}
+
+inline void SaturatorOversampler::clear()
+{
+    mUpsampler1_.clear();
+    mUpsampler2_.clear();
+    mDownsampler2_.clear();
+    mDownsampler1_.clear();
+}
+
+template<typename Curve>
+float SaturatorOversampler::processAudio(float inputSample, Curve curve)
+{
+    switch (mFactor_)
+    {
+        case 2:  return process2x(inputSample, curve);
+        case 4:  return process4x(inputSample, curve);
+        default: return curve(inputSample);
+    }
+}
+
+template<typename Curve>
+void SaturatorOversampler::processAudio(const float* input, float* output, std::size_t size, Curve curve)
+{
+    // Factor dispatched once per block
+    switch (mFactor_)
+    {
+        case 2:  for (std::size_t i = 0; i < size; i++) output[i] = process2x(input[i], curve); break;
+        case 4:  for (std::size_t i = 0; i < size; i++) output[i] = process4x(input[i], curve); break;
+        default: for (std::size_t i = 0; i < size; i++) output[i] = curve(input[i]);             break;
+    }
+}
+
+template<typename Curve>
+inline float SaturatorOversampler::process2x(float inputSample, Curve& curve)
+{
+    float phase0, phase1;
+    mUpsampler1_.processSample(inputSample, phase0, phase1);
+    return mDownsampler1_.processSample(curve(phase0), curve(phase1));
+}
+
+template<typename Curve>
+inline float SaturatorOversampler::process4x(float inputSample, Curve& curve)
+{
+    float phase0, phase1, phase00, phase01, phase10, phase11;
+    mUpsampler1_.processSample(inputSample, phase0, phase1);
+    mUpsampler2_.processSample(phase0, phase00, phase01);
+    mUpsampler2_.processSample(phase1, phase10, phase11);
+    const float down0 = mDownsampler2_.processSample(curve(phase00), curve(phase01));
+    const float down1 = mDownsampler2_.processSample(curve(phase10), curve(phase11));
+    return mDownsampler1_.processSample(down0, down1);
+}
+
+}   // namespace projLib
+
+#endif /* SaturatorOversampler_hpp */
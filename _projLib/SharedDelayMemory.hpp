@@ -0,0 +1,193 @@
+/** -------------------------------------------------------------------------
+    SharedDelayMemory.hpp - Header file for SharedDelayMemory and
+    SharedRingBuffer classes.
+    One power-of-two circular buffer shared by a whole delay network.
+
+    As in Dattorro's original design, every line is a fixed region of a single
+    circular memory, addressed off one write index common to all of them.
+    Advancing the network is one add and one mask, whatever the number of
+    lines.
+
+    SharedRingBuffer is the view of one line: it has the same interface as
+    BlockRingBuffer (so BlockAllPass/BlockDelayLine can run on it), but its
+    writes do not advance anything. The owner of the network advances the
+    SharedDelayMemory once per sample, or once per block after every line has
+    processed the whole block.
+
+    Line layout: a line with delay D and capacity C (>= D + 1 + block size)
+    owns [regionStart, regionStart + C) and is bound at write offset
+    regionStart + D, so its reads, block writes ahead and history never
+    leave its region.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef SharedDelayMemory_hpp
+#define SharedDelayMemory_hpp
+
+#include <cstddef>
+#include <cstring>
+
+namespace projLib {
+
+// Smallest power of two >= n
+constexpr std::size_t nextPowerOfTwo(std::size_t n)
+{
+    std::size_t powerOfTwo = 1;
+    while (powerOfTwo < n) powerOfTwo <<= 1;
+    return powerOfTwo;
+}
+
+class SharedDelayMemory {
+    public:
+        SharedDelayMemory();
+        ~SharedDelayMemory();
+
+        // Bind and clear 'size' floats of storage (size must be a power of two)
+        void init(float* buffer, std::size_t size);
+
+        float* getData() const { return mBuffer_; }
+        std::size_t getSize() const { return mMask_ + 1; }
+        std::size_t getMask() const { return mMask_; }
+        std::size_t getWriteIndex() const { return mWriteIndex_; }
+
+        // Move the write index of every line at once
+        void advance(std::size_t size) { mWriteIndex_ = (mWriteIndex_ + size) & mMask_; }
+
+    private:
+        float* mBuffer_;                            // external storage, mMask_ + 1 long
+        std::size_t mMask_;
+        std::size_t mWriteIndex_;                   // common write position
+};
+
+class SharedRingBuffer {
+    public:
+        using SampleType = float;                   // shared memory is float only
+
+        SharedRingBuffer();
+        ~SharedRingBuffer();
+
+        // Bind to a shared memory, writing at 'writeOffset' from the common write index
+        void init(const SharedDelayMemory* memory, std::size_t writeOffset);
+
+        // Same interface as BlockRingBuffer (indices are absolute in the shared buffer)
+        std::size_t getReadIndex(std::size_t delaySamples) const { return (mMemory_->getWriteIndex() + mWriteOffset_ - delaySamples) & mMemory_->getMask(); }
+        std::size_t getWriteIndex() const { return (mMemory_->getWriteIndex() + mWriteOffset_) & mMemory_->getMask(); }
+        std::size_t getContiguousSamples(std::size_t index) const { return mMemory_->getSize() - index; }
+        std::size_t wrapIndex(std::size_t index) const { return index & mMemory_->getMask(); }
+        float* getData() const { return mMemory_->getData(); }
+
+        // Per-sample access. write() does not advance: the shared memory does.
+        float read(std::size_t delaySamples) const { return mMemory_->getData()[getReadIndex(delaySamples)]; }
+        void write(float inputSample) { mMemory_->getData()[getWriteIndex()] = inputSample; }
+
+        // Block access. Nothing advances here either: writeBlock() fills the block
+        // starting at the common write index.
+        void readBlock(std::size_t delaySamples, float* output, std::size_t size) const;
+        void writeBlock(const float* input, std::size_t size);
+        void clearBlock(std::size_t delaySamples, std::size_t size);
+        void advance(std::size_t size) { (void)size; }
+
+    private:
+        // Copy 'size' samples from/to 'index' on, in up to two contiguous segments
+        void copyFrom(std::size_t index, float* output, std::size_t size) const;
+        void copyTo(std::size_t index, const float* input, std::size_t size) const;
+
+        const SharedDelayMemory* mMemory_;
+        std::size_t mWriteOffset_;                  // line position in the shared buffer
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline SharedDelayMemory::SharedDelayMemory()
+:
+mBuffer_(nullptr),
+mMask_(0),
+mWriteIndex_(0)
+{
+    // NOTE: no storage until init() is called (SDRAM might not be ready yet).
+}
+
+inline SharedDelayMemory::~SharedDelayMemory(){}
+
+inline void SharedDelayMemory::init(float* buffer, std::size_t size)
+{
+    // Bind external storage and clear it (SDRAM is not zeroed at startup)
+    mBuffer_ = buffer;
+    mMask_ = size - 1;
+    mWriteIndex_ = 0;
+    memset(mBuffer_, 0, size*sizeof(float));
+}
+
+inline SharedRingBuffer::SharedRingBuffer()
+:
+mMemory_(nullptr),
+mWriteOffset_(0)
+{
+}
+
+inline SharedRingBuffer::~SharedRingBuffer(){}
+
+inline void SharedRingBuffer::init(const SharedDelayMemory* memory, std::size_t writeOffset)
+{
+    mMemory_ = memory;
+    mWriteOffset_ = writeOffset;
+}
+
+inline void SharedRingBuffer::readBlock(std::size_t delaySamples, float* output, std::size_t size) const
+{
+    copyFrom(getReadIndex(delaySamples), output, size);
+}
+
+inline void SharedRingBuffer::writeBlock(const float* input, std::size_t size)
+{
+    copyTo(getWriteIndex(), input, size);
+}
+
+inline void SharedRingBuffer::clearBlock(std::size_t delaySamples, std::size_t size)
+{
+    std::size_t index = getReadIndex(delaySamples);
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memset(getData() + index, 0, segment*sizeof(float));
+        size -= segment;
+        index = 0;
+    }
+}
+
+inline void SharedRingBuffer::copyFrom(std::size_t index, float* output, std::size_t size) const
+{
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memcpy(output, getData() + index, segment*sizeof(float));
+        output += segment;
+        size -= segment;
+        index = 0;
+    }
+}
+
+inline void SharedRingBuffer::copyTo(std::size_t index, const float* input, std::size_t size) const
+{
+    while (size > 0)
+    {
+        std::size_t segment = getContiguousSamples(index);
+        if (segment > size) segment = size;
+        memcpy(getData() + index, input, segment*sizeof(float));
+        input += segment;
+        size -= segment;
+        index = 0;
+    }
+}
+
+}   // namespace projLib
+
+#endif /* SharedDelayMemory_hpp */
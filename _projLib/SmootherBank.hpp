@@ -0,0 +1,84 @@
+/** -------------------------------------------------------------------------
+    SmootherBank.hpp - Header file for SmootherBank class.
+    Block-linear smoothing of a set of control parameters.
+
+    Every parameter ramps linearly to its target over the ramp time. The ramps
+    advance once per block: processBlock() moves every parameter to its value
+    at the end of the block and gives, for each, its value at the start of the
+    block and a per-sample increment. The caller either ramps the parameter
+    through the block with them (a multiply-add per sample) or applies the end
+    value once (coefficients too costly to recompute per sample). A new target
+    restarts the ramp from the current value, so a knob swept at the control
+    rate is followed without steps.
+
+    A block spreads its move evenly over its samples, so a ramp that ends
+    inside a block would be stretched to the block end. The caller cuts its
+    blocks at getRampEnd() as well (the ramp lengths are whole samples):
+    every ramp then ends after the ramp time, whatever the block sizes.
+
+    The state is stored as one array per field (structure of arrays), padded
+    to a multiple of kLanes: the per-block update is one branch-free loop
+    over all parameters that the compiler vectorises. Once every ramp has
+    reached its target processBlock() returns false straight away, and the
+    caller runs its non-ramped code: a settled bank costs one test per block.
+    (The legacy plugin ran one double precision DeZipper per parameter on
+    every sample instead.)
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef SmootherBank_hpp
+#define SmootherBank_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+template<std::size_t NumParameters>
+class SmootherBank {
+    public:
+        static constexpr std::size_t kLanes = 4;                     // SIMD width the arrays are padded to
+
+        SmootherBank();
+        ~SmootherBank();
+
+        void init(float sampleRate, float rampTime);    // ramp time in seconds, every parameter settled at 0
+        void setValue(std::size_t parameter, float value);      // jump, no ramp
+        void setTarget(std::size_t parameter, float target);    // ramp from the current value
+
+        // Move every ramp over the next 'size' samples. false: all settled, nothing to ramp
+        // in this block (block start and increment are then left from the last ramped block).
+        bool processBlock(std::size_t size);
+        bool isRamping() const { return mIsRamping_; }
+        // Samples to the end of the first ramp to finish ('limit' if none ends before it)
+        std::size_t getRampEnd(std::size_t limit) const;
+
+        float getValue(std::size_t parameter) const { return mValue_[parameter]; }     // at the end of the block
+        float getBlockStart(std::size_t parameter) const { return mBlockStart_[parameter]; }
+        float getBlockStep(std::size_t parameter) const { return mBlockStep_[parameter]; }
+        // The parameter moved in the last processed block (its coefficients need updating)
+        bool isMoving(std::size_t parameter) const { return mBlockStart_[parameter] != mValue_[parameter]; }
+
+    private:
+        static constexpr std::size_t kSize = (NumParameters + kLanes - 1)/kLanes*kLanes;
+
+        float mRampSamples_;                            // ramp length, whole samples
+        float mValue_[kSize];                           // current value (end of the last block)
+        float mTarget_[kSize];
+        float mRampStep_[kSize];                        // per-sample increment of the ramp
+        float mRemaining_[kSize];                       // ramp samples left (0: settled)
+        float mBlockStart_[kSize];                      // value at the start of the last block
+        float mBlockStep_[kSize];                       // per-sample increment in the last block
+        bool mIsRamping_;                               // some ramp still running
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "SmootherBank.tpp"
+
+#endif /* SmootherBank_hpp */
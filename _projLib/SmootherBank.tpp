@@ -0,0 +1,121 @@
+/** -------------------------------------------------------------------------
+    SmootherBank.tpp - Implementation file for SmootherBank class.
+    Block-linear smoothing of a set of control parameters.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "SmootherBank.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<std::size_t NumParameters> constexpr std::size_t SmootherBank<NumParameters>::kLanes;
+template<std::size_t NumParameters> constexpr std::size_t SmootherBank<NumParameters>::kSize;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<std::size_t NumParameters>
+SmootherBank<NumParameters>::SmootherBank()
+:
+mRampSamples_(1.0f),
+mIsRamping_(false)
+{
+    init(48000.0f, 0.0f);
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<std::size_t NumParameters>
+SmootherBank<NumParameters>::~SmootherBank(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<std::size_t NumParameters>
+void SmootherBank<NumParameters>::init(float sampleRate, float rampTime)
+{
+    // Whole samples: a ramp ends on a sample the caller can cut its block at
+    mRampSamples_ = static_cast<float>(static_cast<long>(sampleRate*rampTime + 0.5f));
+    // Padding lanes included: they stay settled at 0 and ride along in the vector loop
+    for (std::size_t i = 0; i < kSize; i++)
+    {
+        mValue_[i] = 0.0f;
+        mTarget_[i] = 0.0f;
+        mRampStep_[i] = 0.0f;
+        mRemaining_[i] = 0.0f;
+        mBlockStart_[i] = 0.0f;
+        mBlockStep_[i] = 0.0f;
+    }
+    mIsRamping_ = false;
+}
+
+template<std::size_t NumParameters>
+void SmootherBank<NumParameters>::setValue(std::size_t parameter, float value)
+{
+    mValue_[parameter] = value;
+    mTarget_[parameter] = value;
+    mRampStep_[parameter] = 0.0f;
+    mRemaining_[parameter] = 0.0f;
+    mBlockStart_[parameter] = value;
+    mBlockStep_[parameter] = 0.0f;
+}
+
+template<std::size_t NumParameters>
+void SmootherBank<NumParameters>::setTarget(std::size_t parameter, float target)
+{
+    if (target == mTarget_[parameter]) return;
+    // Ramps shorter than a sample: nothing to smooth
+    if (mRampSamples_ < 1.0f)
+    {
+        setValue(parameter, target);
+        return;
+    }
+    mTarget_[parameter] = target;
+    mRampStep_[parameter] = (target - mValue_[parameter])/mRampSamples_;
+    mRemaining_[parameter] = mRampSamples_;
+    mIsRamping_ = true;
+}
+
+template<std::size_t NumParameters>
+std::size_t SmootherBank<NumParameters>::getRampEnd(std::size_t limit) const
+{
+    if (!mIsRamping_) return limit;
+    float end = static_cast<float>(limit);
+    for (std::size_t i = 0; i < kSize; i++)
+    {
+        if (mRemaining_[i] > 0.0f && mRemaining_[i] < end) end = mRemaining_[i];
+    }
+    return static_cast<std::size_t>(end);
+}
+
+template<std::size_t NumParameters>
+bool SmootherBank<NumParameters>::processBlock(std::size_t size)
+{
+    if (!mIsRamping_ || size == 0) return false;
+
+    // One pass over every lane, no per-parameter branches (settled lanes give a
+    // zero increment and keep their value)
+    const float blockSamples = static_cast<float>(size);
+    const float inverseBlockSamples = 1.0f/blockSamples;
+    float remainingTotal = 0.0f;
+    for (std::size_t i = 0; i < kSize; i++)
+    {
+        const float start = mValue_[i];
+        const float span = (mRemaining_[i] < blockSamples) ? mRemaining_[i] : blockSamples;
+        const float remaining = mRemaining_[i] - span;
+        // The block that ends a ramp lands on the target exactly
+        const float end = (remaining > 0.0f) ? start + span*mRampStep_[i] : mTarget_[i];
+        mBlockStart_[i] = start;
+        mBlockStep_[i] = (end - start)*inverseBlockSamples;
+        mValue_[i] = end;
+        mRemaining_[i] = remaining;
+        remainingTotal += remaining;
+    }
+    mIsRamping_ = remainingTotal > 0.0f;
+    return true;
+}
+
+}   // namespace projLib
@@ -0,0 +1,65 @@
+/** -------------------------------------------------------------------------
+    SnapshotExchange.hpp - Header file for SnapshotExchange class.
+    Lock-free handoff of a parameter snapshot from one producer thread
+    (e.g. the main loop) to one consumer (e.g. the audio callback).
+
+    Triple buffering: the producer owns one buffer, the consumer another,
+    and the third is exchanged through one atomic index (plus a "fresh"
+    bit). publish() fills the producer's buffer and swaps it with the
+    exchanged one; adopt() swaps the consumer's buffer with the exchanged
+    one if it is fresh. Each swap is a single atomic exchange (acquire +
+    release), so a buffer is never read while it is written, on a single
+    core (callback preempting the main loop) as well as across cores.
+
+    Neither side ever waits or fails: publish() always succeeds, even when
+    the consumer has not adopted the previous snapshot (two buffers alone
+    would have to drop or delay it). The consumer sees whole snapshots
+    only, the latest one at the time it looks: intermediate ones may be
+    skipped.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef SnapshotExchange_hpp
+#define SnapshotExchange_hpp
+
+#include <atomic>
+#include <cstdint>
+
+namespace projLib {
+
+// Snapshot: trivially copyable parameter set
+template<typename Snapshot>
+class SnapshotExchange {
+    public:
+        SnapshotExchange();
+        ~SnapshotExchange();
+
+        // Producer side: hand over a complete snapshot
+        void publish(const Snapshot& snapshot);
+
+        // Consumer side. true: 'snapshot' holds a snapshot newer than the last adopted one.
+        bool adopt(Snapshot& snapshot);
+
+    private:
+        static_assert(ATOMIC_INT_LOCK_FREE == 2, "SnapshotExchange: needs lock-free 32-bit atomics");
+
+        static constexpr uint32_t kFresh = 4;       // exchanged buffer not adopted yet
+        static constexpr uint32_t kIndexMask = 3;
+
+        Snapshot mBuffers_[3];
+        std::atomic<uint32_t> mExchanged_;          // index of the exchanged buffer | kFresh
+        uint32_t mProducerIndex_;                   // buffer owned by publish()
+        uint32_t mConsumerIndex_;                   // buffer owned by adopt()
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "SnapshotExchange.tpp"
+
+#endif /* SnapshotExchange_hpp */
@@ -0,0 +1,62 @@
+/** -------------------------------------------------------------------------
+    SnapshotExchange.tpp - Implementation file for SnapshotExchange class.
+    Lock-free handoff of a parameter snapshot from one producer thread
+    to one consumer.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "SnapshotExchange.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<typename Snapshot> constexpr uint32_t SnapshotExchange<Snapshot>::kFresh;
+template<typename Snapshot> constexpr uint32_t SnapshotExchange<Snapshot>::kIndexMask;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<typename Snapshot>
+SnapshotExchange<Snapshot>::SnapshotExchange()
+:
+mBuffers_(),
+mExchanged_(1),
+mProducerIndex_(0),
+mConsumerIndex_(2)
+{
+    // Nothing fresh until the first publish()
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<typename Snapshot>
+SnapshotExchange<Snapshot>::~SnapshotExchange(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<typename Snapshot>
+void SnapshotExchange<Snapshot>::publish(const Snapshot& snapshot)
+{
+    mBuffers_[mProducerIndex_] = snapshot;
+    // Release: the snapshot is written before the consumer can get the buffer.
+    // Acquire: the consumer is done with the buffer we get back.
+    const uint32_t previous = mExchanged_.exchange(mProducerIndex_ | kFresh, std::memory_order_acq_rel);
+    mProducerIndex_ = previous & kIndexMask;
+}
+
+template<typename Snapshot>
+bool SnapshotExchange<Snapshot>::adopt(Snapshot& snapshot)
+{
+    // Cheap check first: nothing new most of the time
+    if ((mExchanged_.load(std::memory_order_relaxed) & kFresh) == 0) return false;
+
+    const uint32_t previous = mExchanged_.exchange(mConsumerIndex_, std::memory_order_acq_rel);
+    mConsumerIndex_ = previous & kIndexMask;
+    snapshot = mBuffers_[mConsumerIndex_];
+    return true;
+}
+
+}   // namespace projLib
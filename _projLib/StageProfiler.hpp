@@ -0,0 +1,119 @@
+/** -------------------------------------------------------------------------
+    StageProfiler.hpp - Header file for StageProfiler class.
+    Per-stage cycle statistics of a block processor, read without stopping
+    the audio.
+
+    The processing code chains probes through its stages: start() reads
+    the cycle counter (CycleCounter.hpp), and lap(stage, probe) charges the
+    cycles since 'probe' to 'stage' and returns the new reading. One
+    counter read per stage boundary, and a stage may be charged several
+    times in a block (its parts are summed). At the end of every block
+    endBlock() folds the block into the statistics of each stage that ran:
+
+        cycles, samples     totals, mean = cycles/samples per sample
+        min, max            cycles per sample of the cheapest and the
+                            costliest block
+
+    Every kPublishInterval blocks the statistics are handed over through a
+    SnapshotExchange: the main loop (or a host tool) reads the latest ones
+    with getProfile() while the audio keeps running, and restarts them
+    with requestReset() (done by the audio thread at its next block).
+
+    Compiled in with PROJLIB_STAGE_PROFILING defined only. Otherwise the
+    probes are empty inline functions and the profiler holds nothing:
+    the instrumented code is the same as without the probes.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef StageProfiler_hpp
+#define StageProfiler_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "CycleCounter.hpp"
+#include "SnapshotExchange.hpp"
+
+namespace projLib {
+
+#if defined(PROJLIB_STAGE_PROFILING)
+constexpr bool kStageProfiling = true;
+#else
+constexpr bool kStageProfiling = false;
+#endif
+
+// Statistics of one stage, in counter units (see CycleCounter.hpp)
+struct StageStats {
+    std::uint64_t cycles;                       // total
+    std::uint64_t samples;                      // processed by the blocks the stage ran in
+    float minPerSample;                         // over those blocks
+    float maxPerSample;
+
+    float getMeanPerSample() const { return (samples > 0) ? static_cast<float>(cycles)/static_cast<float>(samples) : 0.0f; }
+};
+
+// Statistics of every stage since the last reset
+template<std::size_t NumStages>
+struct StageProfile {
+    StageStats stages[NumStages];
+    std::uint32_t blocks;
+};
+
+// Stage: enum class with values 0 .. NumStages - 1
+template<typename Stage, std::size_t NumStages, bool Enabled = kStageProfiling>
+class StageProfiler {
+    public:
+        using Count = CycleCounter::Count;
+        using Profile = StageProfile<NumStages>;
+        static constexpr std::uint32_t kPublishInterval = 32;      // blocks between two snapshots
+
+        StageProfiler();
+        ~StageProfiler();
+
+        void init();                                // starts the counter, clears the statistics
+
+        // Audio thread
+        static Count start() { return CycleCounter::now(); }
+        Count lap(Stage stage, Count probe);
+        void endBlock(std::size_t size);
+
+        // Reader thread (one): true if 'profile' holds statistics newer than the last read
+        bool getProfile(Profile& profile) { return mExchange_.adopt(profile); }
+        void requestReset() { mIsResetRequested_.store(true, std::memory_order_relaxed); }
+
+    private:
+        void clear();
+
+        Count mBlockCycles_[NumStages];             // charged in the current block
+        Profile mProfile_;
+        std::uint32_t mBlocksToPublish_;
+        std::atomic<bool> mIsResetRequested_;
+        SnapshotExchange<Profile> mExchange_;
+};
+
+// Profiling compiled out: no state, nothing measured
+template<typename Stage, std::size_t NumStages>
+class StageProfiler<Stage, NumStages, false> {
+    public:
+        using Count = CycleCounter::Count;
+        using Profile = StageProfile<NumStages>;
+
+        void init() {}
+        static Count start() { return 0; }
+        Count lap(Stage, Count probe) { return probe; }
+        void endBlock(std::size_t) {}
+        bool getProfile(Profile&) { return false; }
+        void requestReset() {}
+};
+
+}   // namespace projLib
+
+/* Include Implentation file */
+#include "StageProfiler.tpp"
+
+#endif /* StageProfiler_hpp */
@@ -0,0 +1,98 @@
+/** -------------------------------------------------------------------------
+    StageProfiler.tpp - Implementation file for StageProfiler class.
+    Per-stage cycle statistics of a block processor, read without stopping
+    the audio.
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "StageProfiler.hpp"
+
+namespace projLib {
+
+/* ------------------------ Static member definitions ----------------------- */
+template<typename Stage, std::size_t NumStages, bool Enabled> constexpr std::uint32_t StageProfiler<Stage, NumStages, Enabled>::kPublishInterval;
+
+/* ------------------------------- Constructor ------------------------------ */
+template<typename Stage, std::size_t NumStages, bool Enabled>
+StageProfiler<Stage, NumStages, Enabled>::StageProfiler()
+:
+mBlocksToPublish_(kPublishInterval),
+mIsResetRequested_(false)
+{
+    clear();
+}
+/* ------------------------------- Destructor ------------------------------- */
+template<typename Stage, std::size_t NumStages, bool Enabled>
+StageProfiler<Stage, NumStages, Enabled>::~StageProfiler(){}
+/* -------------------------------------------------------------------------- */
+
+
+/* -------------------------------------------------------------------------- */
+/*                               Public Methods                               */
+/* -------------------------------------------------------------------------- */
+template<typename Stage, std::size_t NumStages, bool Enabled>
+void StageProfiler<Stage, NumStages, Enabled>::init()
+{
+    CycleCounter::enable();
+    clear();
+    mBlocksToPublish_ = kPublishInterval;
+}
+
+template<typename Stage, std::size_t NumStages, bool Enabled>
+typename StageProfiler<Stage, NumStages, Enabled>::Count StageProfiler<Stage, NumStages, Enabled>::lap(Stage stage, Count probe)
+{
+    const Count now = CycleCounter::now();
+    mBlockCycles_[static_cast<std::size_t>(stage)] += CycleCounter::elapsed(probe, now);
+    return now;
+}
+
+template<typename Stage, std::size_t NumStages, bool Enabled>
+void StageProfiler<Stage, NumStages, Enabled>::endBlock(std::size_t size)
+{
+    if (mIsResetRequested_.exchange(false, std::memory_order_relaxed)) clear();
+    if (size == 0) return;
+
+    // Stages that did not run in this block (nothing charged) are left out
+    const float inverseSize = 1.0f/static_cast<float>(size);
+    for (std::size_t i = 0; i < NumStages; i++)
+    {
+        const Count blockCycles = mBlockCycles_[i];
+        if (blockCycles == 0) continue;
+        mBlockCycles_[i] = 0;
+
+        StageStats& stats = mProfile_.stages[i];
+        const float perSample = static_cast<float>(blockCycles)*inverseSize;
+        if (stats.samples == 0 || perSample < stats.minPerSample) stats.minPerSample = perSample;
+        if (perSample > stats.maxPerSample) stats.maxPerSample = perSample;
+        stats.cycles += blockCycles;
+        stats.samples += size;
+    }
+    mProfile_.blocks++;
+
+    if (--mBlocksToPublish_ > 0) return;
+    mExchange_.publish(mProfile_);
+    mBlocksToPublish_ = kPublishInterval;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               Private Methods                              */
+/* -------------------------------------------------------------------------- */
+template<typename Stage, std::size_t NumStages, bool Enabled>
+void StageProfiler<Stage, NumStages, Enabled>::clear()
+{
+    for (std::size_t i = 0; i < NumStages; i++)
+    {
+        mBlockCycles_[i] = 0;
+        mProfile_.stages[i].cycles = 0;
+        mProfile_.stages[i].samples = 0;
+        mProfile_.stages[i].minPerSample = 0.0f;
+        mProfile_.stages[i].maxPerSample = 0.0f;
+    }
+    mProfile_.blocks = 0;
+}
+
+}   // namespace projLib
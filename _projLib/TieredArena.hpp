@@ -0,0 +1,167 @@
+/** -------------------------------------------------------------------------
+    TieredArena.hpp - Header file for TieredArena class.
+    Delay memory arena over several memory tiers, with a placement planner.
+
+    Each tier (DTCM, AXI SRAM, SDRAM - fastest first) is a block of floats
+    bound by the project, its size being the tier budget. plan() places a set
+    of buffers: the ones accessed most per float go to the fastest tier with
+    budget left, the rest spill to the slower tiers.
+
+    Every allocation is logged (name, tier, size). The arena has no
+    hardware-specific code: on the host the tiers can be plain arrays and the
+    placement log shows where each buffer landed.
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#pragma once
+#ifndef TieredArena_hpp
+#define TieredArena_hpp
+
+#include <cstddef>
+
+namespace projLib {
+
+// Memory tiers, fastest first
+enum class MemoryTier {
+    DTCM = 0,       // tightly coupled data RAM, no wait states
+    AxiSram,        // internal AXI SRAM
+    Sdram           // external SDRAM
+};
+constexpr std::size_t kNumMemoryTiers = 3;
+
+// One buffer to place. Filled in by the owner, 'buffer' and 'tier' set by TieredArena::plan()
+struct BufferRequest {
+    const char* name;
+    std::size_t size;                           // floats
+    float accessRate;                           // buffer accesses per sample
+    float* buffer;
+    MemoryTier tier;
+};
+
+class TieredArena {
+    public:
+        // Placement log entry
+        struct Placement {
+            const char* name;
+            MemoryTier tier;
+            std::size_t size;                   // floats
+        };
+        static constexpr std::size_t kMaxPlacements = 32;
+        static constexpr std::size_t kAlignment = 8;    // floats: every allocation is rounded up to it
+
+        TieredArena();
+        ~TieredArena();
+
+        // Bind 'size' floats of storage to a tier. Unbound tiers have no budget.
+        void setTier(MemoryTier tier, float* memory, std::size_t size);
+        // Release all allocations and clear the log (tier bindings are kept)
+        void reset();
+
+        // Take 'size' floats from 'tier', or from the next slower tier with budget left.
+        // Returns nullptr when no tier can hold the buffer.
+        float* allocate(std::size_t size, MemoryTier tier, const char* name, MemoryTier* placedTier = nullptr);
+        // Place 'count' buffers by access rate per float, fastest tier first.
+        // Returns false if any buffer did not fit (its 'buffer' is left nullptr).
+        bool plan(BufferRequest* requests, std::size_t count);
+
+        std::size_t getUsed(MemoryTier tier) const { return mTierUsed_[static_cast<std::size_t>(tier)]; }
+        std::size_t getFree(MemoryTier tier) const { return mTierSize_[static_cast<std::size_t>(tier)] - getUsed(tier); }
+        std::size_t getPlacementCount() const { return mPlacementCount_; }
+        const Placement& getPlacement(std::size_t index) const { return mPlacements_[index]; }
+
+    private:
+        float* mTierMemory_[kNumMemoryTiers];
+        std::size_t mTierSize_[kNumMemoryTiers];
+        std::size_t mTierUsed_[kNumMemoryTiers];
+
+        Placement mPlacements_[kMaxPlacements];
+        std::size_t mPlacementCount_;
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline TieredArena::TieredArena()
+:
+mPlacementCount_(0)
+{
+    for (std::size_t t = 0; t < kNumMemoryTiers; t++)
+    {
+        mTierMemory_[t] = nullptr;
+        mTierSize_[t] = 0;
+        mTierUsed_[t] = 0;
+    }
+}
+
+inline TieredArena::~TieredArena(){}
+
+inline void TieredArena::setTier(MemoryTier tier, float* memory, std::size_t size)
+{
+    const std::size_t t = static_cast<std::size_t>(tier);
+    mTierMemory_[t] = memory;
+    mTierSize_[t] = (memory != nullptr) ? size : 0;
+    mTierUsed_[t] = 0;
+}
+
+inline void TieredArena::reset()
+{
+    for (std::size_t t = 0; t < kNumMemoryTiers; t++) mTierUsed_[t] = 0;
+    mPlacementCount_ = 0;
+}
+
+inline float* TieredArena::allocate(std::size_t size, MemoryTier tier, const char* name, MemoryTier* placedTier)
+{
+    // Keep every allocation 32-byte aligned relative to the tier base
+    const std::size_t alignedSize = (size + kAlignment - 1) & ~(kAlignment - 1);
+
+    for (std::size_t t = static_cast<std::size_t>(tier); t < kNumMemoryTiers; t++)
+    {
+        if (mTierSize_[t] - mTierUsed_[t] < alignedSize) continue;
+
+        float* buffer = mTierMemory_[t] + mTierUsed_[t];
+        mTierUsed_[t] += alignedSize;
+        if (mPlacementCount_ < kMaxPlacements)
+        {
+            mPlacements_[mPlacementCount_].name = name;
+            mPlacements_[mPlacementCount_].tier = static_cast<MemoryTier>(t);
+            mPlacements_[mPlacementCount_].size = size;
+            mPlacementCount_++;
+        }
+        if (placedTier != nullptr) *placedTier = static_cast<MemoryTier>(t);
+        return buffer;
+    }
+    return nullptr;
+}
+
+inline bool TieredArena::plan(BufferRequest* requests, std::size_t count)
+{
+    // Placement order: access rate per float, highest first (insertion sort, small sets)
+    std::size_t order[kMaxPlacements];
+    if (count > kMaxPlacements) count = kMaxPlacements;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const float density = requests[i].accessRate/static_cast<float>(requests[i].size);
+        std::size_t j = i;
+        while (j > 0 && requests[order[j - 1]].accessRate/static_cast<float>(requests[order[j - 1]].size) < density)
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    // Greedy: every buffer starts at the fastest tier and spills down when it is full
+    bool placedAll = true;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        BufferRequest& request = requests[order[i]];
+        request.buffer = allocate(request.size, MemoryTier::DTCM, request.name, &request.tier);
+        if (request.buffer == nullptr) placedAll = false;
+    }
+    return placedAll;
+}
+
+}   // namespace projLib
+
+#endif /* TieredArena_hpp */
@@ -0,0 +1,79 @@
+/** -------------------------------------------------------------------------
+    TrackedParameter.hpp - Header file for TrackedParameter class.
+    Control input with change detection and a dead band.
+
+    Remembers the last value it accepted and only accepts a new one that
+    moved further than
+        absoluteThreshold + relativeThreshold*|last value|
+    away from it. Whatever depends on the parameter is recomputed only when
+    update() returns true: an idle panel costs one compare per parameter,
+    and ADC noise inside the dead band never reaches the coefficients. The
+    band is centred on the last accepted value, so a value creeping across
+    its edge is accepted once and not again until it moves on (hysteresis).
+
+    High-level implementation - No hardware-specific code here.
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#pragma once
+#ifndef TrackedParameter_hpp
+#define TrackedParameter_hpp
+
+#include <cmath>
+
+namespace projLib {
+
+class TrackedParameter {
+    public:
+        TrackedParameter();
+        ~TrackedParameter();
+
+        // Dead band around the last accepted value (0, 0: any change is accepted)
+        void setThreshold(float absoluteThreshold, float relativeThreshold = 0.0f);
+        // Accept the next value whatever it is
+        void invalidate() { mIsValid_ = false; }
+
+        // true if 'value' is accepted (the dependent coefficients have to be recomputed)
+        bool update(float value);
+        float getValue() const { return mValue_; }
+
+    private:
+        float mValue_;                              // last accepted value
+        float mAbsoluteThreshold_;
+        float mRelativeThreshold_;
+        bool mIsValid_;                             // false until a value has been accepted
+};
+
+/* -------------------------------------------------------------------------- */
+/*                               Implementation                               */
+/* -------------------------------------------------------------------------- */
+inline TrackedParameter::TrackedParameter()
+:
+mValue_(0.0f),
+mAbsoluteThreshold_(0.0f),
+mRelativeThreshold_(0.0f),
+mIsValid_(false)
+{}
+
+inline TrackedParameter::~TrackedParameter(){}
+
+inline void TrackedParameter::setThreshold(float absoluteThreshold, float relativeThreshold)
+{
+    mAbsoluteThreshold_ = absoluteThreshold;
+    mRelativeThreshold_ = relativeThreshold;
+}
+
+inline bool TrackedParameter::update(float value)
+{
+    if (mIsValid_ && std::fabs(value - mValue_) <= mAbsoluteThreshold_ + mRelativeThreshold_*std::fabs(mValue_))
+        return false;
+    mValue_ = value;
+    mIsValid_ = true;
+    return true;
+}
+
+}   // namespace projLib
+
+#endif /* TrackedParameter_hpp */
@@ -0,0 +1,68 @@
+/*
+    blockKernels.hpp
+
+    Data-parallel block kernels for the projLib delay-based components.
+
+    The kernels work on contiguous segments and assume no sample of the
+    segment depends on another one (i.e. delay >= segment length), which the
+    callers guarantee. SSE/AVX are used on the host; on the Cortex-M7 (no
+    SIMD float unit) the plain loops are left to the compiler.
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#ifndef blockKernels_hpp
+#define blockKernels_hpp
+
+#include <cstddef>
+
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+namespace projLib {
+
+/** Schroeder allpass over a segment, with w[n-D] already in 'delayed':
+ *      w[n] = x[n] - g*w[n-D]          -> written to 'state'
+ *      y[n] = g*w[n] + w[n-D]          -> written to 'output'
+ *  'input' and 'output' may be the same memory.
+ */
+inline void allpassKernel(const float* input, const float* delayed, float* state, float* output,
+                          float feedbackCoefficient, std::size_t size)
+{
+    std::size_t i = 0;
+#if defined(__AVX__)
+    const __m256 g8 = _mm256_set1_ps(feedbackCoefficient);
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(input + i);
+        const __m256 o = _mm256_loadu_ps(delayed + i);
+        const __m256 w = _mm256_sub_ps(x, _mm256_mul_ps(g8, o));
+        _mm256_storeu_ps(state + i, w);
+        _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(g8, w), o));
+    }
+#endif
+#if defined(__SSE__)
+    const __m128 g4 = _mm_set1_ps(feedbackCoefficient);
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(input + i);
+        const __m128 o = _mm_loadu_ps(delayed + i);
+        const __m128 w = _mm_sub_ps(x, _mm_mul_ps(g4, o));
+        _mm_storeu_ps(state + i, w);
+        _mm_storeu_ps(output + i, _mm_add_ps(_mm_mul_ps(g4, w), o));
+    }
+#endif
+    // Scalar loop: remainder on the host, whole segment on the Cortex-M7
+    for (; i < size; i++)
+    {
+        const float o = delayed[i];
+        const float w = input[i] - feedbackCoefficient*o;
+        state[i] = w;
+        output[i] = feedbackCoefficient*w + o;
+    }
+}
+
+}   // namespace projLib
+
+#endif /* blockKernels_hpp */
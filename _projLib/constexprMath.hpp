@@ -0,0 +1,145 @@
+/*
+    constexprMath.hpp
+
+    Compile-time versions of the transcendental functions needed to generate
+    lookup tables (std:: math functions are not constexpr in C++14). Double
+    precision series, accurate to well below float resolution over the
+    ranges the tables use. Not meant for run-time use.
+
+    Matteo Desantis 16-Oct-2026
+*/
+
+#ifndef constexprMath_hpp
+#define constexprMath_hpp
+
+namespace projLib {
+namespace constexprMath {
+
+constexpr double kPi = 3.14159265358979323846;
+
+constexpr double abs(double x)
+{
+    return (x < 0.0) ? -x : x;
+}
+
+// Newton iterations from a start above the root
+constexpr double sqrt(double x)
+{
+    if (x <= 0.0) return 0.0;
+    double root = (x > 1.0) ? x : 1.0;
+    for (int i = 0; i < 64; i++)
+    {
+        const double next = 0.5*(root + x/root);
+        if (next >= root) break;
+        root = next;
+    }
+    return root;
+}
+
+// Taylor series on x/2^k, squared back k times
+constexpr double exp(double x)
+{
+    int halvings = 0;
+    while (abs(x) > 0.5)
+    {
+        x *= 0.5;
+        halvings++;
+    }
+    double sum = 1.0;
+    double term = 1.0;
+    for (int n = 1; n < 20; n++)
+    {
+        term *= x/n;
+        sum += term;
+    }
+    for (int i = 0; i < halvings; i++) sum *= sum;
+    return sum;
+}
+
+// ln(x) = k*ln(2) + 2*atanh((m - 1)/(m + 1)), x = m*2^k with m in [1, 2)
+constexpr double log(double x)
+{
+    if (x <= 0.0) return -1.0e300;
+    int octaves = 0;
+    while (x >= 2.0)
+    {
+        x *= 0.5;
+        octaves++;
+    }
+    while (x < 1.0)
+    {
+        x *= 2.0;
+        octaves--;
+    }
+    const double z = (x - 1.0)/(x + 1.0);
+    const double z2 = z*z;
+    double sum = 0.0;
+    double power = z;
+    for (int n = 0; n < 30; n++)
+    {
+        sum += power/(2*n + 1);
+        power *= z2;
+    }
+    return octaves*0.69314718055994530942 + 2.0*sum;
+}
+
+constexpr double pow(double base, double exponent)
+{
+    return exp(exponent*log(base));
+}
+
+// Taylor series on x reduced to [-pi, pi]
+constexpr double sin(double x)
+{
+    while (x > kPi) x -= 2.0*kPi;
+    while (x < -kPi) x += 2.0*kPi;
+    const double x2 = x*x;
+    double sum = 0.0;
+    double term = x;
+    for (int n = 1; n < 40; n += 2)
+    {
+        sum += term;
+        term *= -x2/((n + 1)*(n + 2));
+    }
+    return sum;
+}
+
+constexpr double cos(double x)
+{
+    return sin(x + 0.5*kPi);
+}
+
+constexpr double tanh(double x)
+{
+    if (x < 0.0) return -tanh(-x);
+    if (x > 20.0) return 1.0;
+    const double e2x = exp(2.0*x);
+    return (e2x - 1.0)/(e2x + 1.0);
+}
+
+// atan(x) = pi/2 - atan(1/x) above 1, then two half-angle reductions and the Taylor series
+constexpr double atan(double x)
+{
+    if (x < 0.0) return -atan(-x);
+    if (x > 1.0) return 0.5*kPi - atan(1.0/x);
+    double scale = 1.0;
+    for (int i = 0; i < 2; i++)
+    {
+        x = x/(1.0 + sqrt(1.0 + x*x));
+        scale *= 2.0;
+    }
+    const double x2 = x*x;
+    double sum = 0.0;
+    double power = x;
+    for (int n = 0; n < 24; n++)
+    {
+        sum += ((n & 1) ? -power : power)/(2*n + 1);
+        power *= x2;
+    }
+    return scale*sum;
+}
+
+}   // namespace constexprMath
+}   // namespace projLib
+
+#endif /* constexprMath_hpp */
@@ -0,0 +1,169 @@
+/** -------------------------------------------------------------------------
+    arenaPlacementCheck.cpp - Host check of the ReverbZ delay line placement.
+
+    Places the ReverbZ lines with init(TieredArena&) over plain arrays sized
+    like the ReverbZpatch tiers (DTCM and AXI SRAM budgets of dspConfig.hpp,
+    an SDRAM tier of kArenaMemorySize floats) and checks the placement log:
+
+    - the patch build (PerLineMasked, float tank, 48 kHz) lands every line
+      in the tier listed in kPatchPlacement;
+    - every storage, tank format and the half-rate network place all their
+      lines, tank allpasses 7 - 10 (Smooth only) after every line that
+      always runs: they only get the room those leave;
+    - an SDRAM-only arena of kArenaMemorySize floats holds every line.
+
+    Exit status 1 on any failure.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../ReverbZpatch/dspConfig.hpp"
+#include "../_projLib/HalfRateReverbZ.hpp"
+#include "../_projLib/ReverbZ.hpp"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+struct ExpectedPlacement {
+    const char* name;
+    MemoryTier tier;
+};
+
+// Patch build, in placement order
+const ExpectedPlacement kPatchPlacement[] = {
+    {"inputAllpass1", MemoryTier::DTCM},
+    {"inputAllpass2", MemoryTier::DTCM},
+    {"inputAllpass4", MemoryTier::DTCM},
+    {"inputAllpass3", MemoryTier::DTCM},
+    {"tankAllpass5", MemoryTier::DTCM},
+    {"tankDelay1", MemoryTier::AxiSram},
+    {"tankDelay2", MemoryTier::AxiSram},
+    {"tankDelay3", MemoryTier::Sdram},
+    {"tankDelay4", MemoryTier::Sdram},
+    {"tankAllpass6", MemoryTier::Sdram},
+    {"tankAllpass7", MemoryTier::Sdram},
+    {"tankAllpass8", MemoryTier::Sdram},
+    {"tankAllpass9", MemoryTier::Sdram},
+    {"tankAllpass10", MemoryTier::Sdram}
+};
+constexpr std::size_t kNumPatchPlacements = sizeof(kPatchPlacement)/sizeof(kPatchPlacement[0]);
+
+const char* kTierNames[kNumMemoryTiers] = {"DTCM", "AXI SRAM", "SDRAM"};
+
+bool isSmoothOnly(const char* name)
+{
+    return std::strcmp(name, "tankAllpass7") == 0 || std::strcmp(name, "tankAllpass8") == 0 ||
+           std::strcmp(name, "tankAllpass9") == 0 || std::strcmp(name, "tankAllpass10") == 0;
+}
+
+// The arena over the patch tiers
+struct PatchTiers {
+    std::vector<float> dtcm;
+    std::vector<float> axiSram;
+    std::vector<float> sdram;
+    TieredArena arena;
+
+    explicit PatchTiers(std::size_t sdramSize)
+    :
+    dtcm(REVERBZ_DTCM_BUDGET),
+    axiSram(REVERBZ_AXI_SRAM_BUDGET),
+    sdram(sdramSize)
+    {
+        arena.setTier(MemoryTier::DTCM, dtcm.data(), dtcm.size());
+        arena.setTier(MemoryTier::AxiSram, axiSram.data(), axiSram.size());
+        arena.setTier(MemoryTier::Sdram, sdram.data(), sdram.size());
+    }
+};
+
+void printPlacement(const TieredArena& arena)
+{
+    for (std::size_t i = 0; i < arena.getPlacementCount(); i++)
+    {
+        const TieredArena::Placement& placement = arena.getPlacement(i);
+        printf("    %-14s %6zu floats in %s\n", placement.name, placement.size,
+               kTierNames[static_cast<std::size_t>(placement.tier)]);
+    }
+}
+
+// Every line placed, the Smooth-only ones last
+template<typename R>
+bool checkReverb(const char* name)
+{
+    std::vector<R> reverbHolder(1);             // too large for the stack
+    bool isPassed = true;
+
+    PatchTiers tiers(R::kArenaMemorySize);
+    if (!reverbHolder[0].init(tiers.arena) || tiers.arena.getPlacementCount() != R::kNumDelayBuffers)
+    {
+        printf("    FAIL: %s: not every line placed over the patch tiers\n", name);
+        isPassed = false;
+    }
+    // The log is in placement order
+    bool isSmoothOnlyPlaced = false;
+    for (std::size_t i = 0; i < tiers.arena.getPlacementCount(); i++)
+    {
+        if (isSmoothOnly(tiers.arena.getPlacement(i).name))
+        {
+            isSmoothOnlyPlaced = true;
+        }
+        else if (isSmoothOnlyPlaced)
+        {
+            printf("    FAIL: %s: %s placed after a Smooth-only allpass\n", name, tiers.arena.getPlacement(i).name);
+            isPassed = false;
+        }
+    }
+
+    PatchTiers sdramOnly(R::kArenaMemorySize);
+    sdramOnly.arena.setTier(MemoryTier::DTCM, nullptr, 0);
+    sdramOnly.arena.setTier(MemoryTier::AxiSram, nullptr, 0);
+    if (!reverbHolder[0].init(sdramOnly.arena))
+    {
+        printf("    FAIL: %s: %zu floats of SDRAM alone do not hold every line\n", name, R::kArenaMemorySize);
+        isPassed = false;
+    }
+
+    printf("%-28s %s\n", name, isPassed ? "ok" : "FAILED");
+    return isPassed;
+}
+
+// The patch build against kPatchPlacement
+bool checkPatchPlacement()
+{
+    using R = ReverbZ<REVERBZ_MAX_PREDELAY_SAMPLES, FS_REVERBZ, DelayStorage::PerLineMasked, Float32Format, LinearInterpolation>;
+    std::vector<R> reverbHolder(1);
+    PatchTiers tiers(R::kArenaMemorySize);
+    bool isPassed = reverbHolder[0].init(tiers.arena) && tiers.arena.getPlacementCount() == kNumPatchPlacements;
+    for (std::size_t i = 0; isPassed && i < kNumPatchPlacements; i++)
+    {
+        const TieredArena::Placement& placement = tiers.arena.getPlacement(i);
+        isPassed = std::strcmp(placement.name, kPatchPlacement[i].name) == 0 && placement.tier == kPatchPlacement[i].tier;
+    }
+    printf("patch build placement:\n");
+    printPlacement(tiers.arena);
+    if (!isPassed) printf("    FAIL: patch build placement differs from the expected one\n");
+    return isPassed;
+}
+
+}   // namespace
+
+int main()
+{
+    bool isPassed = checkPatchPlacement();
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLine>>("float PerLine") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLineMasked>>("float PerLineMasked") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::Shared>>("float Shared") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLine, Float16Format>>("Float16 PerLine") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLineMasked, Float16Format>>("Float16 PerLineMasked") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLine, Int16Format>>("Int16 PerLine") && isPassed;
+    isPassed = checkReverb<ReverbZ<4800, 48000, DelayStorage::PerLineMasked, Int16Format>>("Int16 PerLineMasked") && isPassed;
+    isPassed = checkReverb<HalfRateReverbZ<4800, 48000, DelayStorage::PerLineMasked>>("half-rate float PerLineMasked") && isPassed;
+    isPassed = checkReverb<HalfRateReverbZ<4800, 48000, DelayStorage::PerLine, Float16Format>>("half-rate Float16 PerLine") && isPassed;
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/** -------------------------------------------------------------------------
+    formatSnrReport.cpp - Host report of the ReverbZ tank sample formats.
+
+    Runs the same burst of noise through ReverbZ with its tank lines in
+    float, Float16Format and Int16Format (48 kHz, decay 0.5, 6 s, plain and
+    smoothed tank), and reports for each 16-bit format:
+    - the tank memory against the float one,
+    - the SNR of the output against the float output,
+    - the tail energy per 0.5 s window, float / 16-bit, in dB.
+
+    Exit status 1 if Float16 falls below kMinFloat16Snr or its decay drifts
+    by more than kMaxFloat16DecayError in a window above kDecayFloor (Int16
+    is reported only: its tail is cut short well above that floor).
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/ReverbZ.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kBlockSize = 48;
+constexpr std::size_t kRunSamples = 6*kSampleRate;
+constexpr std::size_t kBurstSamples = kSampleRate/10;
+constexpr std::size_t kWindowSamples = kSampleRate/2;
+constexpr std::size_t kNumWindows = kRunSamples/kWindowSamples;
+
+constexpr double kMinFloat16Snr = 65.0;         // dB
+constexpr double kMaxFloat16DecayError = 0.25;  // dB per window
+constexpr double kDecayFloor = -75.0;           // dB, windows below are not checked
+
+template<typename TankFormat>
+using Reverb = ReverbZ<4800, kSampleRate, DelayStorage::PerLine, TankFormat>;
+
+// Interleaved stereo output of the test run
+template<typename TankFormat>
+std::vector<float> runReverb(int smooth)
+{
+    using R = Reverb<TankFormat>;
+    std::vector<float> memory(R::kDelayMemorySize);
+    std::vector<R> reverbHolder(1);             // too large for the stack
+    R& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    reverb.setProcessMode(R::ProcessMode::StageMajor);
+    reverb.setSleepThreshold(-INFINITY);        // the whole tail, down to the format's floor
+    reverb.setControlParameters(0.0f, 22000.0f, 10.0f, 0.75f, 0.5f, 1.0f, 5000.0f, 20.0f, 100.0f, smooth);
+
+    srand(1);
+    std::vector<float> inL(kRunSamples, 0.0f), inR(kRunSamples, 0.0f), outL(kRunSamples), outR(kRunSamples);
+    for (std::size_t n = 0; n < kBurstSamples; n++)
+    {
+        inL[n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+        inR[n] = -0.5f*inL[n];
+    }
+    for (std::size_t n = 0; n < kRunSamples; n += kBlockSize)
+        reverb.processBlock(&inL[n], &inR[n], &outL[n], &outR[n], kBlockSize);
+
+    std::vector<float> out(2*kRunSamples);
+    for (std::size_t n = 0; n < kRunSamples; n++)
+    {
+        out[2*n] = outL[n];
+        out[2*n + 1] = outR[n];
+    }
+    return out;
+}
+
+double toDb(double energy) { return 10.0*std::log10(energy + 1e-30); }
+
+// Report one format against the float tank, returns false if it fails the Float16 limits
+template<typename TankFormat>
+bool reportFormat(const char* name, int smooth, bool isChecked)
+{
+    const std::vector<float> reference = runReverb<Float32Format>(smooth);
+    const std::vector<float> output = runReverb<TankFormat>(smooth);
+
+    double signal = 0.0, error = 0.0;
+    for (std::size_t i = 0; i < reference.size(); i++)
+    {
+        signal += reference[i]*reference[i];
+        error += (reference[i] - output[i])*(reference[i] - output[i]);
+    }
+    const double snr = toDb(signal) - toDb(error);
+    printf("%-8s %-8s memory %zu -> %zu floats, SNR %.1f dB\n", name, smooth ? "smoothed" : "plain",
+           Reverb<Float32Format>::kDelayMemorySize, Reverb<TankFormat>::kDelayMemorySize, snr);
+
+    printf("    decay (dB per 0.5 s, float / %s):", name);
+    double maxDecayError = 0.0;
+    for (std::size_t w = 0; w < kNumWindows; w++)
+    {
+        double referenceEnergy = 0.0, outputEnergy = 0.0;
+        for (std::size_t i = 2*w*kWindowSamples; i < 2*(w + 1)*kWindowSamples; i++)
+        {
+            referenceEnergy += reference[i]*reference[i];
+            outputEnergy += output[i]*output[i];
+        }
+        const double referenceDb = toDb(referenceEnergy);
+        const double outputDb = toDb(outputEnergy);
+        printf(" %.1f/%.1f", referenceDb, outputDb);
+        if (referenceDb > kDecayFloor) maxDecayError = std::fmax(maxDecayError, std::fabs(referenceDb - outputDb));
+    }
+    printf("\n    max decay error above %.0f dB: %.2f dB\n", kDecayFloor, maxDecayError);
+
+    if (!isChecked) return true;
+    const bool isPassed = (snr >= kMinFloat16Snr) && (maxDecayError <= kMaxFloat16DecayError);
+    if (!isPassed) printf("    FAIL: limits %.0f dB SNR, %.2f dB decay error\n", kMinFloat16Snr, kMaxFloat16DecayError);
+    return isPassed;
+}
+
+}   // namespace
+
+int main()
+{
+    bool isPassed = true;
+    for (int smooth = 0; smooth <= 1; smooth++)
+    {
+        isPassed &= reportFormat<Float16Format>("Float16", smooth, true);
+        reportFormat<Int16Format>("Int16", smooth, false);
+    }
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/** -------------------------------------------------------------------------
+    halfRateReport.cpp - Host report of HalfRateReverbZ against ReverbZ.
+
+    - Cutoff clamps: the wet output (Mix 100 %, 0.25 s noise burst and its
+      tail, 48 kHz) at HF damping and input lowpass settings above
+      kWetBandwidth must be the same, bit for bit, as at kWetBandwidth
+      itself (HF damping: clamped) or just above it (input lowpass: left
+      open, the decimator filters), while a setting in the wet band must
+      change it.
+    - Block partitions: the same run in blocks of 1, 7, 33 and random sizes
+      must give the same output, bit for bit, as in blocks of 48 (no
+      control events: their ramps step once per block).
+    - Delay memory of both classes.
+    - Cost per 48 kHz sample of ReverbZ, of the half-rate network alone
+      (HalfRateReverbZ::Network at 24 kHz) and of the whole HalfRateReverbZ
+      (resamplers and dry mix included): 48-sample blocks of stereo noise,
+      Smooth on, silence sleep off, both process modes, drive off and at
+      3 dB; best of kNumRuns runs of 1 s.
+
+    Exit status 1 if a clamp does not hold or a partition changes the
+    output. Memory and costs are reported only, the costs depend on the
+    host.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/HalfRateReverbZ.hpp"
+#include "../_projLib/ReverbZ.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kBlockSize = 48;
+constexpr std::size_t kClampSamples = kSampleRate;          // 1 s: burst and tail
+constexpr std::size_t kBurstSamples = kSampleRate/4;
+constexpr std::size_t kMaxBlockSize = 256;
+constexpr int kNumPartitions = 4;
+constexpr std::size_t kPartitions[kNumPartitions] = {1, 7, 33, 0};     // 0: random sizes in [1, kMaxBlockSize]
+const char* kPartitionNames[kNumPartitions] = {"1", "7", "33", "random"};
+constexpr std::size_t kCostSamples = kSampleRate;
+constexpr int kNumRuns = 12;
+
+using FullRate = ReverbZ<4800, kSampleRate, DelayStorage::PerLineMasked>;
+using HalfRate = HalfRateReverbZ<4800, kSampleRate, DelayStorage::PerLineMasked>;
+
+// Settings under test, the others at the defaults of the run
+struct Cutoffs {
+    float inputLowpassFc;
+    float hfDampingFc;
+};
+
+// Wet output of the clamp run, interleaved; blocks of 'partition' samples (0: random sizes up to 256)
+std::vector<float> runClamp(const Cutoffs& cutoffs, std::size_t partition = kBlockSize)
+{
+    std::vector<float> memory(HalfRate::kDelayMemorySize);
+    std::vector<HalfRate> reverbHolder(1);      // too large for the stack
+    HalfRate& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    reverb.setControlParameters(0.0f, cutoffs.inputLowpassFc, 10.0f, 0.75f, 0.8f, 0.0f, cutoffs.hfDampingFc, 20.0f, 100.0f, 0);
+
+    srand(2);
+    std::vector<float> in(kClampSamples, 0.0f), outL(kClampSamples), outR(kClampSamples);
+    for (std::size_t n = 0; n < kBurstSamples; n++)
+        in[n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+    std::uint32_t random = 1;
+    for (std::size_t n = 0; n < kClampSamples; )
+    {
+        random = random*1664525u + 1013904223u;
+        std::size_t size = partition ? partition : 1 + (random >> 8) % kMaxBlockSize;
+        if (size > kClampSamples - n) size = kClampSamples - n;
+        reverb.processBlock(&in[n], &in[n], &outL[n], &outR[n], size);
+        n += size;
+    }
+
+    std::vector<float> out(2*kClampSamples);
+    for (std::size_t n = 0; n < kClampSamples; n++)
+    {
+        out[2*n] = outL[n];
+        out[2*n + 1] = outR[n];
+    }
+    return out;
+}
+
+double energy(const std::vector<float>& out)
+{
+    double sum = 0.0;
+    for (float sample : out)
+        sum += static_cast<double>(sample)*sample;
+    return sum;
+}
+
+// Runs at 'settings' against the run at 'reference': identical when 'isClamped', different otherwise
+bool checkClamp(const char* name, const Cutoffs& reference, const Cutoffs* settings, const float* values,
+                const bool* isClamped, int numSettings)
+{
+    const std::vector<float> referenceOut = runClamp(reference);
+    bool isPassed = true;
+    for (int k = 0; k < numSettings; k++)
+    {
+        const std::vector<float> out = runClamp(settings[k]);
+        const bool isIdentical = (out == referenceOut);
+        printf("%-14s %7.0f Hz: wet energy %.6f, %s\n", name, values[k], energy(out),
+               isIdentical ? "same as the clamp" : "differs");
+        if (isIdentical != isClamped[k])
+        {
+            printf("    FAIL: %s at %.0f Hz %s\n", name, values[k],
+                   isClamped[k] ? "differs from the clamp" : "has no effect");
+            isPassed = false;
+        }
+    }
+    return isPassed;
+}
+
+// Nanoseconds per 48 kHz sample of stereo noise (independent channels: the network input is
+// their sum), 'decimation' 2 for the network alone at 24 kHz
+template<typename R>
+double measureCost(bool isStageMajor, float drive, std::size_t decimation)
+{
+    std::vector<float> memory(R::kDelayMemorySize);
+    std::vector<R> reverbHolder(1);
+    R& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    reverb.setProcessMode(isStageMajor ? R::ProcessMode::StageMajor : R::ProcessMode::SampleMajor);
+    reverb.setSleepThreshold(-INFINITY);
+    reverb.setControlParameters(10.0f, 8000.0f, 20.0f, 0.75f, 0.7f, drive, 4000.0f, 20.0f, 50.0f, 1);
+
+    srand(1);
+    std::vector<float> inL(kCostSamples), inR(kCostSamples), outL(kCostSamples), outR(kCostSamples);
+    for (std::size_t n = 0; n < kCostSamples; n++)
+    {
+        inL[n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+        inR[n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+    }
+    double best = 1.0e30;
+    for (int run = 0; run < kNumRuns; run++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t n = 0; n < kCostSamples/decimation; n += kBlockSize)
+            reverb.processBlock(&inL[n], &inR[n], &outL[n], &outR[n], kBlockSize);
+        best = std::fmin(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return 1.0e9*best/kCostSamples;
+}
+
+void reportCost(bool isStageMajor, float drive)
+{
+    const double fullRate = measureCost<FullRate>(isStageMajor, drive, 1);
+    const double network = measureCost<HalfRate::Network>(isStageMajor, drive, 2);
+    const double halfRate = measureCost<HalfRate>(isStageMajor, drive, 1);
+    printf("%-11s drive %.0f dB: ReverbZ %5.1f ns/sample, network at 24 kHz %5.1f (%.2fx), HalfRateReverbZ %5.1f (%.2fx)\n",
+           isStageMajor ? "StageMajor" : "SampleMajor", drive, fullRate, network, network/fullRate, halfRate, halfRate/fullRate);
+}
+
+}   // namespace
+
+int main()
+{
+    const float bandEdge = HalfRate::kWetBandwidth;
+
+    // HF damping: clamped to the band edge
+    const float hfValues[] = {bandEdge, 15000.0f, 20000.0f, 8000.0f};
+    const bool hfIsClamped[] = {true, true, true, false};
+    Cutoffs hfSettings[4];
+    for (int k = 0; k < 4; k++)
+        hfSettings[k] = {22000.0f, hfValues[k]};
+    bool isPassed = checkClamp("HF damping", {22000.0f, bandEdge}, hfSettings, hfValues, hfIsClamped, 4);
+
+    // Input lowpass: open above the band edge
+    const float lowpassValues[] = {bandEdge + 1.0f, 16000.0f, 22000.0f, 8000.0f};
+    const bool lowpassIsClamped[] = {true, true, true, false};
+    Cutoffs lowpassSettings[4];
+    for (int k = 0; k < 4; k++)
+        lowpassSettings[k] = {lowpassValues[k], 5000.0f};
+    isPassed = checkClamp("input lowpass", {bandEdge + 1.0f, 5000.0f}, lowpassSettings, lowpassValues,
+                          lowpassIsClamped, 4) && isPassed;
+
+    // Odd block sizes: the same output whatever the partition (no control events, whose
+    // ramps step once per block)
+    const std::vector<float> reference = runClamp({22000.0f, 5000.0f});
+    for (int p = 0; p < kNumPartitions; p++)
+    {
+        const bool isIdentical = (runClamp({22000.0f, 5000.0f}, kPartitions[p]) == reference);
+        printf("blocks of %-6s: %s\n", kPartitionNames[p], isIdentical ? "same as blocks of 48" : "differs");
+        if (!isIdentical)
+        {
+            printf("    FAIL: blocks of %s samples change the output\n", kPartitionNames[p]);
+            isPassed = false;
+        }
+    }
+
+    printf("delay memory: ReverbZ %zu floats, HalfRateReverbZ %zu floats (%.2fx)\n",
+           FullRate::kDelayMemorySize, HalfRate::kDelayMemorySize,
+           static_cast<double>(HalfRate::kDelayMemorySize)/FullRate::kDelayMemorySize);
+
+    reportCost(false, 0.0f);
+    reportCost(false, 3.0f);
+    reportCost(true, 0.0f);
+    reportCost(true, 3.0f);
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/** -------------------------------------------------------------------------
+    interpolationBenchmark.cpp - Host benchmark of the fractional read policies.
+
+    For LinearInterpolation, HermiteInterpolation and AllpassInterpolation:
+
+    - magnitude of a ModulatedAllPass read at the fraction 0.5 (the worst
+      case of linear), feedback 0, 48 kHz, at 1, 10 and 16 kHz;
+    - cost of one LFO-modulated line, its ModulationEngine share included:
+      two modulated allpasses in series on 64-sample blocks, counter ticks
+      per sample per line (CycleCounter: TSC cycles on x86-64), best of
+      kNumRuns runs.
+
+    Exit status 1 if AllpassInterpolation is not flat within kMaxAllpassError
+    at every frequency, or if Hermite is not brighter than linear at 10 kHz.
+    The costs are reported only, they depend on the host.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/CycleCounter.hpp"
+#include "../_projLib/ModulatedAllPass.hpp"
+#include "../_projLib/ModulationEngine.hpp"
+#include <cmath>
+#include <cstdio>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kBlockSize = 64;
+constexpr std::size_t kCostSamples = 20*kSampleRate;       // 20 s per run
+constexpr int kNumRuns = 5;
+constexpr int kNumFrequencies = 3;
+constexpr float kFrequencies[kNumFrequencies] = {1000.0f, 10000.0f, 16000.0f};
+constexpr float kMaxAllpassError = 0.5f;                    // dB
+
+struct Report {
+    float gainDb[kNumFrequencies];
+    double ticksPerSample;
+};
+
+// Peak gain of a sine through a fixed fractional read, after the line is full
+template<typename Interpolation>
+float measureGainDb(float frequency)
+{
+    static float memory[256];
+    ModulatedAllPass<200, Interpolation> line;
+    line.init(memory);
+    line.setDelaySamples(100);
+    line.setFeedbackCoefficient(0.0f);
+
+    float peak = 0.0f;
+    for (int n = 0; n < kSampleRate; n++)
+    {
+        const float output = line.processAudio(std::sin(2.0f*static_cast<float>(M_PI)*frequency*n/kSampleRate), 0.5f);
+        if (n > kSampleRate/2)
+            peak = std::fmax(peak, std::fabs(output));
+    }
+    return 20.0f*std::log10(peak);
+}
+
+// Two modulated lines in series, each on the sine of its own LFO
+template<typename Interpolation>
+double measureTicksPerSample()
+{
+    static float memory1[2048], memory2[4096];
+    ModulatedAllPass<2000, Interpolation> line1;
+    ModulatedAllPass<3000, Interpolation> line2;
+    line1.init(memory1);
+    line2.init(memory2);
+    line1.setDelaySamples(1000);
+    line2.setDelaySamples(1500);
+    line1.setFeedbackCoefficient(0.7f);
+    line2.setFeedbackCoefficient(0.7f);
+
+    ModulationEngine<2> engine;
+    engine.init(kSampleRate);
+    engine.setRate(0, 0.6f);
+    engine.setRate(1, 0.8f);
+    engine.setDepth(ModulationEngine<2>::sineOutput(0), 24.0f);
+    engine.setDepth(ModulationEngine<2>::sineOutput(1), 48.0f);
+
+    float input[kBlockSize], output[kBlockSize], modulation1[kBlockSize], modulation2[kBlockSize], unused[kBlockSize];
+    float* outputs[ModulationEngine<2>::kNumOutputs] = {unused, unused, unused, unused};
+    outputs[ModulationEngine<2>::sineOutput(0)] = modulation1;
+    outputs[ModulationEngine<2>::sineOutput(1)] = modulation2;
+    for (std::size_t i = 0; i < kBlockSize; i++)
+        input[i] = std::sin(0.1f*i);
+
+    CycleCounter::enable();
+    CycleCounter::Count best = ~CycleCounter::Count(0);
+    volatile float sink = 0.0f;                             // keeps the lines from being optimised out
+    for (int run = 0; run < kNumRuns; run++)
+    {
+        const CycleCounter::Count start = CycleCounter::now();
+        for (std::size_t n = 0; n < kCostSamples; n += kBlockSize)
+        {
+            engine.processBlock(outputs, kBlockSize);
+            line1.processAudio(input, output, modulation1, kBlockSize);
+            line2.processAudio(output, output, modulation2, kBlockSize);
+            sink = sink + output[kBlockSize - 1];
+        }
+        const CycleCounter::Count elapsed = CycleCounter::elapsed(start, CycleCounter::now());
+        if (elapsed < best)
+            best = elapsed;
+    }
+    return static_cast<double>(best)/kCostSamples/2;
+}
+
+template<typename Interpolation>
+Report runBenchmark(const char* name)
+{
+    Report report;
+    for (int k = 0; k < kNumFrequencies; k++)
+        report.gainDb[k] = measureGainDb<Interpolation>(kFrequencies[k]);
+    report.ticksPerSample = measureTicksPerSample<Interpolation>();
+
+    printf("%-8s", name);
+    for (int k = 0; k < kNumFrequencies; k++)
+        printf("  %6.2f dB", report.gainDb[k]);
+    printf("  %8.1f\n", report.ticksPerSample);
+    return report;
+}
+
+}   // namespace
+
+int main()
+{
+    printf("fraction 0.5    1 kHz     10 kHz     16 kHz    ticks/sample/line\n");
+    const Report linear = runBenchmark<LinearInterpolation>("linear");
+    const Report hermite = runBenchmark<HermiteInterpolation>("Hermite");
+    const Report allpass = runBenchmark<AllpassInterpolation>("allpass");
+
+    bool isPassed = true;
+    for (int k = 0; k < kNumFrequencies; k++)
+    {
+        if (std::fabs(allpass.gainDb[k]) > kMaxAllpassError)
+        {
+            printf("    FAIL: allpass read not flat at %.0f Hz\n", kFrequencies[k]);
+            isPassed = false;
+        }
+    }
+    if (hermite.gainDb[1] <= linear.gainDb[1])
+    {
+        printf("    FAIL: Hermite read not brighter than linear at 10 kHz\n");
+        isPassed = false;
+    }
+    printf("cost relative to linear: Hermite %.2fx, allpass %.2fx\n",
+           hermite.ticksPerSample/linear.ticksPerSample, allpass.ticksPerSample/linear.ticksPerSample);
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/** -------------------------------------------------------------------------
+    loadMonitorCheck.cpp - Host check of the LoadMonitor accounting.
+
+    A HostCallbackTimer stands in for the audio interrupt (48 kHz, 48-sample
+    blocks: 1 ms period, windows of 100 callbacks) and a LoadMonitor times
+    its callback, busy for kBusyFraction of the period, and for
+    kOverrunFraction of it in kNumForcedOverruns callbacks of the second
+    window. The main thread reads the telemetry as the main loop would,
+    calls resetPeaks() once the overruns are past, and reads on.
+
+    - Simulated clock: the callback advances the clock by its busy counts
+      instead of spinning, so the figures do not depend on the host
+      scheduling and are checked exactly: the overrun count, the window
+      load, the peak load and worst callback of the overrun window, and
+      the peaks back to the plain callbacks after resetPeaks().
+    - SteadyClock: the callback busy-waits. A preempted callback only
+      lasts longer, so the figures are checked as lower bounds: at least
+      the forced overruns, the worst callback at least kOverrunFraction,
+      the window load at least kBusyFraction.
+
+    Exit status 1 on any failure.
+
+    Host-only (standard library, POSIX threads).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/HostCallbackTimer.hpp"
+#include "../_projLib/LoadMonitor.hpp"
+#include <cmath>
+#include <cstdio>
+
+using namespace projLib;
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr std::size_t kBlockSize = 48;
+constexpr float kWindowTime = 0.1f;
+constexpr std::uint32_t kWindowCallbacks = 100;             // kWindowTime at 1 ms per callback
+
+constexpr float kBusyFraction = 0.2f;                       // of the period, in every callback
+constexpr float kOverrunFraction = 1.5f;                    // in the forced overruns
+constexpr std::uint32_t kFirstForcedOverrun = 150;          // second window
+constexpr std::uint32_t kNumForcedOverruns = 5;
+constexpr float kTolerance = 1.0e-4f;                       // float rounding of the simulated loads
+
+// Clock advanced by the callback itself (timer thread only), rate of SteadyClock
+struct SimulatedClock {
+    using Count = std::uint64_t;
+    static Count sNow;
+
+    static void enable() {}
+    static Count now() { return sNow; }
+    static Count elapsed(Count start, Count end) { return end - start; }
+};
+SimulatedClock::Count SimulatedClock::sNow = 0;
+
+struct Spin {
+    static void run(SimulatedClock::Count counts) { SimulatedClock::sNow += counts; }
+};
+
+struct BusyWait {
+    static void run(SteadyClock::Count counts)
+    {
+        const SteadyClock::Count start = SteadyClock::now();
+        while (SteadyClock::elapsed(start, SteadyClock::now()) < counts) {}
+    }
+};
+
+// Telemetry before and after resetPeaks()
+struct Readings {
+    LoadTelemetry before;
+    LoadTelemetry after;
+};
+
+// Poll the telemetry (10 ms) until 'callbacks' callbacks are accounted for
+template<typename Clock>
+LoadTelemetry waitForCallbacks(LoadMonitor<Clock>& monitor, std::uint32_t callbacks)
+{
+    LoadTelemetry telemetry = LoadTelemetry();
+    while (telemetry.callbacks < callbacks)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        monitor.getTelemetry(telemetry);
+    }
+    return telemetry;
+}
+
+template<typename Clock, typename Busy>
+Readings runMonitor(const char* name)
+{
+    LoadMonitor<Clock> monitor;
+    monitor.init(SteadyClock::kRate, kSampleRate, kBlockSize, kWindowTime);
+    const typename Clock::Count budget = monitor.getBudget();
+
+    std::uint32_t callback = 0;             // timer thread only
+    HostCallbackTimer timer;
+    timer.start([&monitor, &callback, budget]()
+    {
+        const typename Clock::Count start = monitor.beginCallback();
+        const bool isOverrun = callback >= kFirstForcedOverrun && callback < kFirstForcedOverrun + kNumForcedOverruns;
+        Busy::run(static_cast<typename Clock::Count>((isOverrun ? kOverrunFraction : kBusyFraction)*budget));
+        callback++;
+        monitor.endCallback(start);
+    }, kSampleRate, kBlockSize);
+
+    // Past the forced overruns and a window of plain callbacks
+    Readings readings;
+    readings.before = waitForCallbacks(monitor, 4*kWindowCallbacks);
+    monitor.resetPeaks();
+    // The window in progress at the reset still counts: two more after it
+    readings.after = waitForCallbacks(monitor, readings.before.callbacks + 3*kWindowCallbacks);
+    timer.stop();
+
+    printf("%s:\n", name);
+    printf("    before reset: load %5.1f %%, peak %5.1f %%, worst %6.1f %%, overruns %2u, callbacks %u\n",
+           100.0f*readings.before.load, 100.0f*readings.before.peakLoad, 100.0f*readings.before.worstLoad,
+           readings.before.overruns, readings.before.callbacks);
+    printf("    after reset:  load %5.1f %%, peak %5.1f %%, worst %6.1f %%, overruns %2u, callbacks %u\n",
+           100.0f*readings.after.load, 100.0f*readings.after.peakLoad, 100.0f*readings.after.worstLoad,
+           readings.after.overruns, readings.after.callbacks);
+    return readings;
+}
+
+bool check(bool condition, const char* failure)
+{
+    if (!condition) printf("    FAIL: %s\n", failure);
+    return condition;
+}
+
+bool isNear(float value, float expected)
+{
+    return std::fabs(value - expected) < kTolerance;
+}
+
+}   // namespace
+
+int main()
+{
+    // Second window: the overruns on top of the busy fraction
+    const float overrunWindowLoad = kBusyFraction + kNumForcedOverruns*(kOverrunFraction - kBusyFraction)/kWindowCallbacks;
+
+    const Readings simulated = runMonitor<SimulatedClock, Spin>("simulated clock");
+    bool isPassed = check(simulated.before.overruns == kNumForcedOverruns && simulated.after.overruns == kNumForcedOverruns,
+                          "overrun count differs from the forced overruns");
+    isPassed = check(isNear(simulated.before.load, kBusyFraction) && isNear(simulated.after.load, kBusyFraction),
+                     "window load differs from the busy fraction") && isPassed;
+    isPassed = check(isNear(simulated.before.peakLoad, overrunWindowLoad), "peak load differs from the overrun window") && isPassed;
+    isPassed = check(isNear(simulated.before.worstLoad, kOverrunFraction), "worst callback differs from the forced overruns") && isPassed;
+    isPassed = check(isNear(simulated.after.peakLoad, kBusyFraction) && isNear(simulated.after.worstLoad, kBusyFraction),
+                     "resetPeaks() kept the overrun peaks") && isPassed;
+
+    const Readings steady = runMonitor<SteadyClock, BusyWait>("SteadyClock");
+    isPassed = check(steady.before.overruns >= kNumForcedOverruns, "fewer overruns than the forced ones") && isPassed;
+    isPassed = check(steady.before.worstLoad >= kOverrunFraction, "worst callback shorter than the forced overruns") && isPassed;
+    isPassed = check(steady.before.load >= kBusyFraction && steady.after.load >= kBusyFraction,
+                     "window load below the busy fraction") && isPassed;
+    isPassed = check(steady.after.overruns >= steady.before.overruns && steady.after.callbacks > steady.before.callbacks,
+                     "overrun or callback count went back") && isPassed;
+    return isPassed ? 0 : 1;
+}
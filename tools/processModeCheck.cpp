@@ -0,0 +1,244 @@
+/** -------------------------------------------------------------------------
+    processModeCheck.cpp - Host check of the ReverbZ process modes.
+
+    The stage-major path must give the same output as the sample-major one,
+    bit for bit, and so must every delay storage. The same 1.5 s run (two
+    noise bursts and their tails, 48 kHz) goes through ReverbZ in:
+
+        SampleMajor / StageMajor
+        x PerLine / PerLineMasked / Shared storage (Shared: float tank only)
+        x float / Float16Format / Int16Format tank (linear interpolation),
+          and Hermite / allpass interpolation (float, PerLineMasked)
+        x mono / stereo processBlock()
+
+    with the Smooth switch off and on, the saturator oversampled 2x and 4x,
+    and blocks of 1, 4 and 256 samples and of random sizes. HalfRateReverbZ
+    goes through the same runs (float tank, PerLine / PerLineMasked
+    storage), with blocks of 1, 7, 33 and 256 samples and of random sizes:
+    odd sizes leave a full-rate sample pending between blocks. Every run has
+    sample-accurate control events (drive across the oversampling
+    thresholds, decay, damping, mix, predelay) and a Smooth switch toggle
+    from the control side half way through.
+
+    Each run is compared with the SampleMajor / PerLine one of the same
+    class, configuration and block sizes. Exit status 1 on any difference.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/HalfRateReverbZ.hpp"
+#include "../_projLib/ReverbZ.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kRunSamples = 3*kSampleRate/2;
+constexpr std::size_t kBurstSamples = kSampleRate/4;
+constexpr std::size_t kSecondBurst = kSampleRate;              // start of the second burst
+constexpr std::size_t kToggleSample = 3*kSampleRate/5;         // Smooth toggled at the first block from here
+constexpr std::size_t kMaxBlockSize = 256;
+
+constexpr int kNumPartitions = 4;
+constexpr std::size_t kPartitions[kNumPartitions] = {1, 4, 256, 0};     // 0: random sizes in [1, kMaxBlockSize]
+constexpr int kNumHalfRatePartitions = 5;
+constexpr std::size_t kHalfRatePartitions[kNumHalfRatePartitions] = {1, 7, 33, 256, 0};
+constexpr int kNumOversampling = 2;
+constexpr int kOversampling[kNumOversampling] = {2, 4};
+
+template<DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+using Reverb = ReverbZ<4800, kSampleRate, Storage, TankFormat, ModInterpolation>;
+template<DelayStorage Storage>
+using HalfRate = HalfRateReverbZ<4800, kSampleRate, Storage>;
+
+// Control event at an absolute sample time of the run
+template<typename ControlParameter>
+struct TimedEvent {
+    std::size_t time;
+    ControlParameter parameter;
+    float value;
+};
+
+struct Configuration {
+    int smooth;
+    int oversampling;
+    std::size_t partition;
+    bool isMono;
+};
+
+// Deterministic pseudo-random sequence (input noise and random block sizes)
+struct Random {
+    std::uint32_t state;
+    std::uint32_t next()
+    {
+        state = state*1664525u + 1013904223u;
+        return state >> 8;
+    }
+    float nextSample() { return next()/static_cast<float>(1u << 24) - 0.5f; }
+};
+
+// Interleaved output of the test run (mono runs: one channel)
+template<typename R>
+std::vector<float> runReverb(typename R::ProcessMode processMode, const Configuration& configuration)
+{
+    using Parameter = typename R::ControlParameter;
+    const TimedEvent<Parameter> events[] = {
+        {1000, Parameter::Drive, 6.0f},             // oversampling on
+        {5003, Parameter::Decay, 0.9f},
+        {5003, Parameter::HfDamping, 1200.0f},
+        {9000, Parameter::PredelayTime, 35.0f},
+        {12017, Parameter::Mix, 40.0f},             // once the tank output is there
+        {20000, Parameter::Drive, 0.0f},            // oversampling off
+        {30011, Parameter::LfDamping, 300.0f},
+        {50000, Parameter::Drive, 12.0f},
+        {50000, Parameter::Decay, 0.5f},
+        {60001, Parameter::PredelayTime, 0.0f},     // predelay bypassed
+        {61000, Parameter::InputDiffusion, 0.3f}
+    };
+    const std::size_t numEvents = sizeof(events)/sizeof(events[0]);
+
+    std::vector<float> memory(R::kDelayMemorySize);
+    std::vector<R> reverbHolder(1);             // too large for the stack
+    R& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    reverb.setProcessMode(processMode);
+    reverb.setSaturatorOversampling(configuration.oversampling);
+    reverb.setControlParameters(20.0f, 18000.0f, 30.0f, 0.75f, 0.8f, 0.0f, 5000.0f, 40.0f, 70.0f, configuration.smooth);
+
+    Random random = {1};
+    std::vector<float> inL(kRunSamples, 0.0f), inR(kRunSamples, 0.0f), outL(kRunSamples), outR(kRunSamples);
+    for (std::size_t n = 0; n < kBurstSamples; n++)
+    {
+        inL[n] = random.nextSample();
+        inR[n] = -0.5f*inL[n];
+        inL[kSecondBurst + n] = 0.5f*random.nextSample();
+        inR[kSecondBurst + n] = inL[kSecondBurst + n];
+    }
+
+    std::size_t nextEvent = 0;
+    bool isToggled = false;
+    for (std::size_t n = 0; n < kRunSamples; )
+    {
+        std::size_t size = configuration.partition ? configuration.partition : 1 + random.next() % kMaxBlockSize;
+        if (size > kRunSamples - n) size = kRunSamples - n;
+        while (nextEvent < numEvents && events[nextEvent].time < n + size)
+        {
+            reverb.scheduleControl(events[nextEvent].parameter, events[nextEvent].value, events[nextEvent].time - n);
+            nextEvent++;
+        }
+        if (!isToggled && n >= kToggleSample)
+        {
+            reverb.setControlParameters(20.0f, 18000.0f, 30.0f, 0.75f, 0.8f, 0.0f, 5000.0f, 40.0f, 70.0f, !configuration.smooth);
+            isToggled = true;
+        }
+        if (configuration.isMono)
+            reverb.processBlock(&inL[n], &outL[n], size);
+        else
+            reverb.processBlock(&inL[n], &inR[n], &outL[n], &outR[n], size);
+        n += size;
+    }
+
+    if (configuration.isMono) return outL;
+    std::vector<float> out(2*kRunSamples);
+    for (std::size_t n = 0; n < kRunSamples; n++)
+    {
+        out[2*n] = outL[n];
+        out[2*n + 1] = outR[n];
+    }
+    return out;
+}
+
+// Number of samples that differ, and the largest difference
+struct Difference {
+    std::size_t count;
+    float maxError;
+};
+
+Difference compare(const std::vector<float>& reference, const std::vector<float>& output)
+{
+    Difference difference = {0, 0.0f};
+    for (std::size_t i = 0; i < reference.size(); i++)
+    {
+        if (output[i] != reference[i])
+        {
+            difference.count++;
+            difference.maxError = std::fmax(difference.maxError, std::fabs(output[i] - reference[i]));
+        }
+    }
+    return difference;
+}
+
+// Both process modes of R against SampleMajor of Reference, returns false on a difference
+template<typename Reference, typename R>
+bool checkReverb(const char* name, const std::size_t* partitions, int numPartitions)
+{
+    const typename R::ProcessMode modes[] = {R::ProcessMode::SampleMajor, R::ProcessMode::StageMajor};
+    const char* modeNames[] = {"SampleMajor", "StageMajor"};
+    // The reference itself is not compared with itself
+    const int firstMode = std::is_same<Reference, R>::value ? 1 : 0;
+
+    std::size_t numRuns = 0, numFailed = 0;
+    for (int mono = 0; mono < 2; mono++)
+    for (int smooth = 0; smooth < 2; smooth++)
+    for (int o = 0; o < kNumOversampling; o++)
+    for (int p = 0; p < numPartitions; p++)
+    {
+        const Configuration configuration = {smooth, kOversampling[o], partitions[p], mono == 1};
+        const std::vector<float> reference = runReverb<Reference>(Reference::ProcessMode::SampleMajor, configuration);
+        for (int m = firstMode; m < 2; m++)
+        {
+            const Difference difference = compare(reference, runReverb<R>(modes[m], configuration));
+            numRuns++;
+            if (difference.count == 0) continue;
+            numFailed++;
+            printf("    FAIL: %s %s, smooth %d, oversampling %dx, blocks %zu%s: %zu samples differ (max %g)\n",
+                   name, modeNames[m], smooth, kOversampling[o], partitions[p], mono ? ", mono" : "",
+                   difference.count, difference.maxError);
+        }
+    }
+    printf("%-30s %3zu runs against SampleMajor / PerLine, %zu differ\n", name, numRuns, numFailed);
+    return numFailed == 0;
+}
+
+// One storage of ReverbZ against PerLine
+template<DelayStorage Storage, typename TankFormat, typename ModInterpolation>
+bool checkStorage(const char* name)
+{
+    return checkReverb<Reverb<DelayStorage::PerLine, TankFormat, ModInterpolation>, Reverb<Storage, TankFormat, ModInterpolation>>(
+        name, kPartitions, kNumPartitions);
+}
+
+// One storage of HalfRateReverbZ against PerLine
+template<DelayStorage Storage>
+bool checkHalfRate(const char* name)
+{
+    return checkReverb<HalfRate<DelayStorage::PerLine>, HalfRate<Storage>>(name, kHalfRatePartitions, kNumHalfRatePartitions);
+}
+
+}   // namespace
+
+int main()
+{
+    // Shared storage is float only
+    bool isPassed = checkStorage<DelayStorage::PerLine, Float32Format, LinearInterpolation>("float PerLine");
+    isPassed = checkStorage<DelayStorage::PerLineMasked, Float32Format, LinearInterpolation>("float PerLineMasked") && isPassed;
+    isPassed = checkStorage<DelayStorage::Shared, Float32Format, LinearInterpolation>("float Shared") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLine, Float16Format, LinearInterpolation>("Float16 PerLine") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLineMasked, Float16Format, LinearInterpolation>("Float16 PerLineMasked") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLine, Int16Format, LinearInterpolation>("Int16 PerLine") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLineMasked, Int16Format, LinearInterpolation>("Int16 PerLineMasked") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLineMasked, Float32Format, HermiteInterpolation>("float PerLineMasked Hermite") && isPassed;
+    isPassed = checkStorage<DelayStorage::PerLineMasked, Float32Format, AllpassInterpolation>("float PerLineMasked allpass") && isPassed;
+    isPassed = checkHalfRate<DelayStorage::PerLine>("half-rate float PerLine") && isPassed;
+    isPassed = checkHalfRate<DelayStorage::PerLineMasked>("half-rate float PerLineMasked") && isPassed;
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+/** -------------------------------------------------------------------------
+    sleepCheck.cpp - Host check of the ReverbZ silence sleep.
+
+    The same 12 s run (a 0.1 s noise burst, 6 s of silence, a second burst
+    and its tail, 48 kHz, modulation off) goes through ReverbZ with the
+    default sleep threshold and with sleep off (-inf), in both process
+    modes, Smooth off and on, blocks of 48 samples and of random sizes.
+    The network must fall asleep in the silence (the sleeping output goes
+    to exact zeros while the never-sleeping tail still rings), and wake up
+    on the second burst with the output of the never-sleeping one within
+    kMaxDifferenceDb.
+
+    With modulation on, the LFOs keep running in the never-sleeping network
+    only: after a wake-up the phases differ and so do the outputs (by
+    design, not checked here).
+
+    Exit status 1 on a larger difference or a run that never sleeps.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/ReverbZ.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kRunSamples = 12*kSampleRate;
+constexpr std::size_t kBurstSamples = kSampleRate/10;
+constexpr std::size_t kSecondBurst = 6*kSampleRate;
+constexpr std::size_t kBlockSize = 48;
+constexpr std::size_t kMaxBlockSize = 64;
+constexpr float kMaxDifferenceDb = -110.0f;                // dBFS
+
+using Reverb = ReverbZ<4800, kSampleRate>;
+
+// Interleaved output of the test run
+std::vector<float> runReverb(bool isSleepOn, bool isStageMajor, int smooth, std::size_t partition)
+{
+    std::vector<float> memory(Reverb::kDelayMemorySize);
+    std::vector<Reverb> reverbHolder(1);        // too large for the stack
+    Reverb& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    if (!isSleepOn) reverb.setSleepThreshold(-INFINITY);
+    reverb.setModulationDepth(0.0f);
+    reverb.setProcessMode(isStageMajor ? Reverb::ProcessMode::StageMajor : Reverb::ProcessMode::SampleMajor);
+    reverb.setControlParameters(0.0f, 22000.0f, 10.0f, 0.75f, 0.3f, 6.0f, 5000.0f, 20.0f, 50.0f, smooth);
+
+    srand(1);
+    std::vector<float> inL(kRunSamples, 0.0f), inR(kRunSamples, 0.0f), outL(kRunSamples), outR(kRunSamples);
+    for (std::size_t n = 0; n < kBurstSamples; n++)
+    {
+        inL[n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+        inL[kSecondBurst + n] = rand()/static_cast<float>(RAND_MAX) - 0.5f;
+        inR[n] = -0.5f*inL[n];
+        inR[kSecondBurst + n] = -0.5f*inL[kSecondBurst + n];
+    }
+
+    std::uint32_t random = 1;
+    for (std::size_t n = 0; n < kRunSamples; )
+    {
+        random = random*1664525u + 1013904223u;
+        std::size_t size = partition ? partition : 1 + (random >> 8) % kMaxBlockSize;
+        if (size > kRunSamples - n) size = kRunSamples - n;
+        reverb.processBlock(&inL[n], &inR[n], &outL[n], &outR[n], size);
+        n += size;
+    }
+
+    std::vector<float> out(2*kRunSamples);
+    for (std::size_t n = 0; n < kRunSamples; n++)
+    {
+        out[2*n] = outL[n];
+        out[2*n + 1] = outR[n];
+    }
+    return out;
+}
+
+// One configuration, returns false on a failure
+bool checkSleep(bool isStageMajor, int smooth, std::size_t partition)
+{
+    const std::vector<float> awake = runReverb(false, isStageMajor, smooth, partition);
+    const std::vector<float> sleeping = runReverb(true, isStageMajor, smooth, partition);
+
+    // Asleep: the end of the silence is exact zeros in the sleeping run only
+    bool isAsleep = true, isAwakeRinging = false;
+    for (std::size_t i = 2*(kSecondBurst - kSampleRate); i < 2*kSecondBurst; i++)
+    {
+        isAsleep = isAsleep && sleeping[i] == 0.0f;
+        isAwakeRinging = isAwakeRinging || awake[i] != 0.0f;
+    }
+    float maxDifference = 0.0f;
+    for (std::size_t i = 0; i < awake.size(); i++)
+        maxDifference = std::fmax(maxDifference, std::fabs(sleeping[i] - awake[i]));
+    const float differenceDb = 20.0f*std::log10(maxDifference + 1.0e-30f);
+
+    const bool isPassed = isAsleep && isAwakeRinging && differenceDb < kMaxDifferenceDb;
+    printf("%-11s smooth %d, blocks %-6s: %s, max difference %7.1f dBFS%s\n",
+           isStageMajor ? "StageMajor" : "SampleMajor", smooth, partition ? "48" : "random",
+           isAsleep && isAwakeRinging ? "slept" : "NEVER SLEPT", differenceDb, isPassed ? "" : "  FAILED");
+    return isPassed;
+}
+
+}   // namespace
+
+int main()
+{
+    bool isPassed = true;
+    for (int mode = 0; mode < 2; mode++)
+    for (int smooth = 0; smooth < 2; smooth++)
+    {
+        isPassed = checkSleep(mode == 1, smooth, kBlockSize) && isPassed;
+        isPassed = checkSleep(mode == 1, smooth, 0) && isPassed;
+    }
+    if (!isPassed) printf("    FAIL: sleep changes the output by more than %.0f dBFS, or never happens\n", kMaxDifferenceDb);
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/** -------------------------------------------------------------------------
+    snapshotThreadCheck.cpp - Host check of the control/audio thread handoff.
+
+    Built with ThreadSanitizer (see the Makefile), two real threads:
+
+    - SnapshotExchange alone: a producer publishes kNumSnapshots snapshots,
+      every word of snapshot i set to i; the consumer polls adopt() and
+      checks that each adopted snapshot is whole (all words equal) and
+      newer than the previous one.
+    - ReverbZ: a control thread keeps calling the setters (controls, smooth
+      toggle, modulation depth, oversampling, process mode) while the main
+      thread runs kNumBlocks blocks of audio. The output must stay finite.
+
+    Exit status 1 on a torn or out-of-order snapshot or a non-finite output;
+    ThreadSanitizer exits with status 66 if it reports a data race.
+
+    Host-only (standard library, POSIX threads).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/ReverbZ.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr unsigned kNumSnapshots = 2000000;
+constexpr std::size_t kSnapshotWords = 32;
+constexpr int kNumBlocks = 20000;
+constexpr std::size_t kBlockSize = 48;
+
+using Reverb = ReverbZ<4800, 48000>;
+
+struct Snapshot {
+    unsigned words[kSnapshotWords];
+};
+
+bool checkExchange()
+{
+    static SnapshotExchange<Snapshot> exchange;
+    std::atomic<bool> isDone{false};
+
+    std::thread producer([&]() {
+        Snapshot snapshot;
+        for (unsigned i = 1; i <= kNumSnapshots; i++)
+        {
+            for (unsigned& word : snapshot.words)
+                word = i;
+            exchange.publish(snapshot);
+        }
+        isDone = true;
+    });
+
+    long numAdopted = 0, numTorn = 0, numOutOfOrder = 0;
+    unsigned last = 0;
+    Snapshot snapshot;
+    bool isFinal = false;
+    while (!isFinal)
+    {
+        isFinal = isDone;                   // one last look after the producer is done
+        if (!exchange.adopt(snapshot))
+            continue;
+        numAdopted++;
+        for (unsigned word : snapshot.words)
+        {
+            if (word != snapshot.words[0])
+            {
+                numTorn++;
+                break;
+            }
+        }
+        if (snapshot.words[0] <= last)
+            numOutOfOrder++;
+        last = snapshot.words[0];
+    }
+    producer.join();
+
+    printf("exchange: %ld of %u snapshots adopted, last %u, %ld torn, %ld out of order\n",
+           numAdopted, kNumSnapshots, last, numTorn, numOutOfOrder);
+    return numTorn == 0 && numOutOfOrder == 0 && last == kNumSnapshots;
+}
+
+bool checkReverb()
+{
+    std::vector<float> memory(Reverb::kDelayMemorySize);
+    std::vector<Reverb> reverbHolder(1);        // too large for the stack
+    Reverb& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    std::atomic<bool> isStopped{false};
+
+    std::thread control([&]() {
+        for (unsigned k = 0; !isStopped; k++)
+        {
+            const float t = (k % 1000)/1000.0f;
+            reverb.setControlParameters(50.0f*t, 1000.0f + 20000.0f*t, 10.0f + 100.0f*t, t, t, 20.0f*t,
+                                        400.0f + 19000.0f*t, 10.0f + 2000.0f*t, 100.0f*t, (k/500) % 2);
+            if (k % 97 == 0)
+                reverb.setModulationDepth(t);
+            if (k % 89 == 0)
+                reverb.setSaturatorOversampling((k/89) % 2 ? 4 : 1);
+            if (k % 71 == 0)
+                reverb.setProcessMode((k/71) % 2 ? Reverb::ProcessMode::StageMajor : Reverb::ProcessMode::SampleMajor);
+        }
+    });
+
+    float in[kBlockSize], outL[kBlockSize], outR[kBlockSize];
+    for (std::size_t i = 0; i < kBlockSize; i++)
+        in[i] = 0.1f;
+    bool isFinite = true;
+    for (int b = 0; b < kNumBlocks; b++)
+    {
+        reverb.processBlock(in, in, outL, outR, kBlockSize);
+        for (std::size_t i = 0; i < kBlockSize; i++)
+            isFinite = isFinite && std::isfinite(outL[i]) && std::isfinite(outR[i]);
+    }
+    isStopped = true;
+    control.join();
+
+    printf("reverb: %d blocks against the control thread, output %s\n", kNumBlocks, isFinite ? "finite" : "NOT finite");
+    return isFinite;
+}
+
+}   // namespace
+
+int main()
+{
+    const bool isExchangePassed = checkExchange();
+    const bool isReverbPassed = checkReverb();
+    return isExchangePassed && isReverbPassed ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/** -------------------------------------------------------------------------
+    tailBenchmark.cpp - Host benchmark of ReverbZ on a decaying tail.
+
+    Times 30 s of steady-state processing (noise in) against the last 30 s
+    of a 60 s tail (silence in, after the noise), 48 kHz, 48-sample blocks,
+    in both process modes. The silence sleep is off: the whole network keeps
+    running on the tail, so the decaying states reach the subnormal range
+    (where a host FPU without flush-to-zero slows down many times over).
+
+    Exit status 1 if the tail takes more than kMaxTailRatio times the
+    steady state in any mode. Each figure is the best of kNumRuns runs.
+
+    Host-only (standard library).
+
+
+    Matteo Desantis 17-Oct-2026
+*/
+
+#include "../_projLib/ReverbZ.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace projLib;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr std::size_t kBlockSize = 48;
+constexpr std::size_t kPhaseSamples = 30*kSampleRate;      // 30 s per phase
+constexpr int kNumRuns = 3;
+constexpr double kMaxTailRatio = 1.5;
+
+using Reverb = ReverbZ<4800, kSampleRate, DelayStorage::PerLineMasked>;
+
+struct Timing {
+    double steadySeconds;
+    double tailSeconds;
+};
+
+// Process one phase of noise or silence, returns the time it took
+double processPhase(Reverb& reverb, bool isNoise)
+{
+    float inL[kBlockSize], inR[kBlockSize], outL[kBlockSize], outR[kBlockSize];
+    double elapsed = 0.0;
+    for (std::size_t n = 0; n < kPhaseSamples; n += kBlockSize)
+    {
+        for (std::size_t i = 0; i < kBlockSize; i++)
+        {
+            inL[i] = isNoise ? rand()/static_cast<float>(RAND_MAX) - 0.5f : 0.0f;
+            inR[i] = inL[i];
+        }
+        const auto start = std::chrono::steady_clock::now();
+        reverb.processBlock(inL, inR, outL, outR, kBlockSize);
+        elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return elapsed;
+}
+
+Timing runBenchmark(Reverb::ProcessMode processMode)
+{
+    std::vector<float> memory(Reverb::kDelayMemorySize);
+    std::vector<Reverb> reverbHolder(1);        // too large for the stack
+    Reverb& reverb = reverbHolder[0];
+    reverb.init(memory.data());
+    reverb.setProcessMode(processMode);
+    reverb.setSleepThreshold(-INFINITY);
+    reverb.setControlParameters(0.0f, 22000.0f, 10.0f, 0.75f, 0.5f, 1.0f, 5000.0f, 20.0f, 100.0f, 1);
+
+    srand(1);
+    Timing timing;
+    timing.steadySeconds = processPhase(reverb, true);
+    processPhase(reverb, false);
+    timing.tailSeconds = processPhase(reverb, false);
+    return timing;
+}
+
+}   // namespace
+
+int main()
+{
+    const Reverb::ProcessMode modes[] = {Reverb::ProcessMode::SampleMajor, Reverb::ProcessMode::StageMajor};
+    const char* modeNames[] = {"sample-major", "stage-major"};
+    bool isPassed = true;
+    for (int m = 0; m < 2; m++)
+    {
+        Timing best = runBenchmark(modes[m]);
+        for (int run = 1; run < kNumRuns; run++)
+        {
+            const Timing timing = runBenchmark(modes[m]);
+            best.steadySeconds = std::fmin(best.steadySeconds, timing.steadySeconds);
+            best.tailSeconds = std::fmin(best.tailSeconds, timing.tailSeconds);
+        }
+        const double ratio = best.tailSeconds/best.steadySeconds;
+        printf("%-12s steady 30 s: %.3f s, last 30 s of a 60 s tail: %.3f s, ratio %.2f\n",
+               modeNames[m], best.steadySeconds, best.tailSeconds, ratio);
+        if (ratio > kMaxTailRatio)
+        {
+            printf("    FAIL: the tail costs more than %.1fx the steady state\n", kMaxTailRatio);
+            isPassed = false;
+        }
+    }
+    return isPassed ? 0 : 1;
+}